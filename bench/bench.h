@@ -0,0 +1,51 @@
+#ifndef BENCH_H
+# define BENCH_H
+
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                  BENCH                                    */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+# include "../include/minishell.h"
+
+/*   BENCH CONSTANTS   */
+# define BENCH_DEFAULT_OPS 10000
+# define BENCH_ENV_SIZE 2000
+# define BENCH_PATH_DIRS 64
+# define BENCH_DENSE_VARS 64
+# define BENCH_LINE_REPEAT 8
+# define BENCH_LINE_SIZE 4096
+# define BENCH_ENTRY_SIZE 64
+# define BENCH_LEXER_LINE "echo \"hello world\" 'single $q' | grep -v foo \
+> /tmp/out < /etc/hostname >> /tmp/app | wc -l "
+
+typedef struct s_bench
+{
+	const char		*name;
+	long			ops;
+	long			ns;
+	struct timespec	start;
+}	t_bench;
+
+/*   Fonctions de bench_utils.c   */
+void	init_bench(t_bench *bench, const char *name, long ops);
+void	bench_start(t_bench *bench);
+void	bench_stop(t_bench *bench);
+void	bench_report(t_bench *bench);
+
+/*   Fonctions de bench_main.c   */
+long	get_bench_ops(int ac, char **av);
+
+/*   Fonctions de bench_env.c   */
+char	*bench_entry(const char *fmt, int index);
+char	*build_bench_path(void);
+char	**build_bench_env(void);
+void	init_bench_data(t_data *data, char **env);
+void	build_dense_line(char *line);
+
+/*   Fonctions de bench_core.c   */
+void	bench_lexer(t_data *data, long ops);
+void	bench_expand(t_data *data, long ops);
+void	bench_find_command_path(t_data *data, long ops);
+void	bench_get_new_env(t_data *data, long ops);
+
+#endif
@@ -0,0 +1,88 @@
+#include "bench.h"
+
+/*
+	Seul le lexer est chronometre : l'ajout des espaces autour des
+	operateurs est fait avant, comme dans parse_command_line.
+*/
+void	bench_lexer(t_data *data, long ops)
+{
+	t_bench			bench;
+	t_trash_memory	*mark;
+	char			line[BENCH_LINE_SIZE];
+	int				i;
+
+	line[0] = '\0';
+	i = ZERO_INIT;
+	while (i++ < BENCH_LINE_REPEAT)
+		strcat(line, BENCH_LEXER_LINE);
+	init_bench(&bench, "lexer", ops);
+	mark = data->trash_memory;
+	while (ops--)
+	{
+		data->minishell_input_cmd = add_spaces_around_operators(data, line);
+		bench_start(&bench);
+		ft_init_lexer_process(data);
+		bench_stop(&bench);
+		release_trash_until(data, mark);
+	}
+	bench_report(&bench);
+}
+
+void	bench_expand(t_data *data, long ops)
+{
+	t_bench			bench;
+	t_trash_memory	*mark;
+	char			line[BENCH_LINE_SIZE];
+	char			**env;
+
+	build_dense_line(line);
+	init_bench(&bench, "expand", ops);
+	mark = data->trash_memory;
+	while (ops--)
+	{
+		data->minishell_input_cmd = add_spaces_around_operators(data, line);
+		ft_init_lexer_process(data);
+		env = get_new_env(\
+		data, data->utils->linked_list_full_env_var_copy_alpha);
+		bench_start(&bench);
+		expand(data->quote, env, data->lexer_list, data);
+		bench_stop(&bench);
+		release_trash_until(data, mark);
+	}
+	bench_report(&bench);
+}
+
+void	bench_find_command_path(t_data *data, long ops)
+{
+	t_bench			bench;
+	t_trash_memory	*mark;
+
+	init_bench(&bench, "find_command_full_path", ops);
+	mark = data->trash_memory;
+	while (ops--)
+	{
+		bench_start(&bench);
+		find_command_full_path(\
+		"true", data->utils->linked_list_full_env_var_copy_alpha, data);
+		bench_stop(&bench);
+		release_trash_until(data, mark);
+	}
+	bench_report(&bench);
+}
+
+void	bench_get_new_env(t_data *data, long ops)
+{
+	t_bench			bench;
+	t_trash_memory	*mark;
+
+	init_bench(&bench, "get_new_env", ops);
+	mark = data->trash_memory;
+	while (ops--)
+	{
+		bench_start(&bench);
+		get_new_env(data, data->utils->linked_list_full_env_var_copy_alpha);
+		bench_stop(&bench);
+		release_trash_until(data, mark);
+	}
+	bench_report(&bench);
+}
@@ -0,0 +1,56 @@
+#!/bin/sh
+# Benchmarks de bout en bout : chaque script est genere puis execute par
+# "minishell FILE". Une ligne JSON par scenario, au format de minishell_bench.
+# Usage : bench_e2e.sh [./minishell]
+
+SHELL_BIN=${1:-./minishell}
+WORK_DIR=$(mktemp -d "${TMPDIR:-/tmp}/minishell_bench.XXXXXX")
+trap 'rm -rf "$WORK_DIR"' EXIT INT TERM
+
+TRUE_LINES=10000
+BUILTIN_LINES=10000
+PIPELINE_LINES=200
+PIPELINE_STAGES=16
+HEREDOC_COUNT=2000
+HEREDOC_BODY=20
+
+now_ns() {
+	date +%s%N
+}
+
+# run_case NOM OPS SCRIPT
+run_case() {
+	start=$(now_ns)
+	"$SHELL_BIN" "$3" > /dev/null 2>&1
+	end=$(now_ns)
+	awk -v name="$1" -v ops="$2" -v ns="$((end - start))" 'BEGIN {
+		printf "{\"bench\":\"%s\",\"ops\":%d,\"ns_per_op\":%.1f,", name, ops, ns / ops
+		printf "\"ops_per_sec\":%.0f}\n", (ns > 0) ? ops * 1e9 / ns : 0
+	}'
+}
+
+awk -v n=$TRUE_LINES 'BEGIN { for (i = 0; i < n; i++) print "true" }' \
+	> "$WORK_DIR/true.sh"
+awk -v n=$BUILTIN_LINES 'BEGIN { for (i = 0; i < n; i++) print "echo $HOME > /dev/null" }' \
+	> "$WORK_DIR/builtin.sh"
+awk -v n=$PIPELINE_LINES -v s=$PIPELINE_STAGES 'BEGIN {
+	for (i = 0; i < n; i++) {
+		line = "echo x"
+		for (j = 1; j < s; j++)
+			line = line " | cat"
+		print line " > /dev/null"
+	}
+}' > "$WORK_DIR/pipeline.sh"
+awk -v n=$HEREDOC_COUNT -v b=$HEREDOC_BODY 'BEGIN {
+	for (i = 0; i < n; i++) {
+		print "cat << EOF > /dev/null"
+		for (j = 0; j < b; j++)
+			print "line " j " of heredoc " i " with $HOME"
+		print "EOF"
+	}
+}' > "$WORK_DIR/heredoc.sh"
+
+run_case e2e_true $TRUE_LINES "$WORK_DIR/true.sh"
+run_case e2e_builtin $BUILTIN_LINES "$WORK_DIR/builtin.sh"
+run_case e2e_pipeline_$PIPELINE_STAGES $PIPELINE_LINES "$WORK_DIR/pipeline.sh"
+run_case e2e_heredoc $HEREDOC_COUNT "$WORK_DIR/heredoc.sh"
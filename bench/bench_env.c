@@ -0,0 +1,97 @@
+#include "bench.h"
+
+char	*bench_entry(const char *fmt, int index)
+{
+	char	*entry;
+
+	entry = malloc(BENCH_ENTRY_SIZE);
+	if (entry)
+		snprintf(entry, BENCH_ENTRY_SIZE, fmt, index, index);
+	return (entry);
+}
+
+/*
+	PATH de BENCH_PATH_DIRS repertoires qui n'existent pas avant /usr/bin :
+	le pire cas de la recherche, un access() par repertoire.
+*/
+char	*build_bench_path(void)
+{
+	char	*path;
+	size_t	len;
+	int		i;
+
+	path = malloc(BENCH_PATH_DIRS * BENCH_ENTRY_SIZE);
+	if (!path)
+		return (NULL);
+	len = snprintf(path, BENCH_ENTRY_SIZE, "PATH=");
+	i = ZERO_INIT;
+	while (i < BENCH_PATH_DIRS)
+	{
+		len += snprintf(path + len, BENCH_ENTRY_SIZE, \
+		"/nonexistent/bench/%d:", i);
+		i++;
+	}
+	snprintf(path + len, BENCH_ENTRY_SIZE, "/usr/bin:/bin");
+	return (path);
+}
+
+char	**build_bench_env(void)
+{
+	char	**env;
+	int		i;
+
+	env = malloc(sizeof(char *) * (BENCH_ENV_SIZE + 3));
+	if (!env)
+		return (NULL);
+	i = ZERO_INIT;
+	while (i < BENCH_ENV_SIZE)
+	{
+		env[i] = bench_entry("BENCH_VAR_%d=value_%d", i);
+		i++;
+	}
+	env[i++] = build_bench_path();
+	env[i++] = bench_entry("HOME=/tmp", 0);
+	env[i] = NULL;
+	return (env);
+}
+
+void	init_bench_data(t_data *data, char **env)
+{
+	static char	*av[4];
+
+	av[0] = "bench";
+	av[1] = COMMAND_STRING_OPTION;
+	av[2] = "";
+	init_data(data, 3, av, env);
+	init_input_source(data, 3, av);
+	data->utils = init_env(data, env);
+	data->utils->head_of_linked_list_env_var = NULL;
+}
+
+/*
+	Ligne dense en expansions : des $VAR nus, colles et entre quotes,
+	repartis sur tout l'environnement pour eviter un cache trop favorable.
+*/
+void	build_dense_line(char *line)
+{
+	size_t	len;
+	int		i;
+	int		var;
+
+	len = snprintf(line, BENCH_LINE_SIZE, "echo");
+	i = ZERO_INIT;
+	while (i < BENCH_DENSE_VARS)
+	{
+		var = (i * 31) % BENCH_ENV_SIZE;
+		if (i % 3 == 0)
+			len += snprintf(line + len, BENCH_LINE_SIZE - len, \
+			" $BENCH_VAR_%d", var);
+		else if (i % 3 == 1)
+			len += snprintf(line + len, BENCH_LINE_SIZE - len, \
+			" \"$BENCH_VAR_%d$BENCH_VAR_%d\"", var, var + 1);
+		else
+			len += snprintf(line + len, BENCH_LINE_SIZE - len, \
+			" pre_$BENCH_VAR_%d'_post'", var);
+		i++;
+	}
+}
@@ -0,0 +1,37 @@
+#include "bench.h"
+
+long	get_bench_ops(int ac, char **av)
+{
+	long	ops;
+
+	ops = BENCH_DEFAULT_OPS;
+	if (ac > 1)
+		ops = atol(av[1]);
+	if (ops <= 0)
+		ops = BENCH_DEFAULT_OPS;
+	return (ops);
+}
+
+/*
+	Microbenchmarks des phases du shell, lies aux objets de minishell
+	(tout sauf main.o). Le nombre d'operations par benchmark se passe en
+	argument : ./minishell_bench [OPS]
+*/
+int	main(int ac, char **av)
+{
+	t_data	data;
+	char	**env;
+	long	ops;
+
+	ops = get_bench_ops(ac, av);
+	env = build_bench_env();
+	if (!env)
+		return (1);
+	init_bench_data(&data, env);
+	bench_lexer(&data, ops);
+	bench_expand(&data, ops);
+	bench_find_command_path(&data, ops);
+	bench_get_new_env(&data, ops);
+	ft_free_all(&data);
+	return (0);
+}
@@ -0,0 +1,40 @@
+#include "bench.h"
+
+void	init_bench(t_bench *bench, const char *name, long ops)
+{
+	bench->name = name;
+	bench->ops = ops;
+	bench->ns = ZERO_INIT;
+}
+
+void	bench_start(t_bench *bench)
+{
+	clock_gettime(CLOCK_MONOTONIC, &bench->start);
+}
+
+void	bench_stop(t_bench *bench)
+{
+	struct timespec	end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	bench->ns += elapsed_trace_ns(&bench->start, &end);
+}
+
+/*
+	Une ligne JSON par benchmark, au meme format que bench_e2e.sh, pour
+	pouvoir comparer deux runs avec jq ou un simple diff.
+*/
+void	bench_report(t_bench *bench)
+{
+	double	ns_per_op;
+	double	ops_per_sec;
+
+	ns_per_op = (double)bench->ns / bench->ops;
+	ops_per_sec = 0;
+	if (bench->ns > 0)
+		ops_per_sec = bench->ops * (double)NSEC_PER_SEC / bench->ns;
+	printf("{\"bench\":\"%s\",\"ops\":%ld,\"ns_per_op\":%.1f,"
+		"\"ops_per_sec\":%.0f}\n", bench->name, bench->ops, ns_per_op,
+		ops_per_sec);
+	fflush(stdout);
+}
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Feeds minishell a script of 1000 heredocs and reports the elapsed time.
+# Usage: bench/heredoc_1k.sh [path/to/minishell] [lines_per_heredoc]
+
+MINISHELL=${1:-./minishell}
+LINES=${2:-10}
+SCRIPT=$(mktemp)
+trap 'rm -f "$SCRIPT"' EXIT
+
+i=0
+while [ $i -lt 1000 ]; do
+	echo "cat << EOF > /dev/null"
+	j=0
+	while [ $j -lt "$LINES" ]; do
+		echo "heredoc $i line $j \$HOME"
+		j=$((j + 1))
+	done
+	echo "EOF"
+	i=$((i + 1))
+done > "$SCRIPT"
+
+start=$(date +%s%N)
+"$MINISHELL" < "$SCRIPT" > /dev/null 2>&1
+end=$(date +%s%N)
+elapsed=$(( (end - start) / 1000 ))
+echo "heredoc_1k: 1000 heredocs x $LINES lines in ${elapsed}us" \
+	"($(( elapsed / 1000 ))us/heredoc)"
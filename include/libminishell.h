@@ -0,0 +1,29 @@
+#ifndef LIBMINISHELL_H
+# define LIBMINISHELL_H
+
+# include <stddef.h>
+
+/*
+	Interpreteur minishell embarquable, sans readline ni prompt.
+
+	ms_init      copie envp dans l'environnement du shell. envp doit rester
+	             valide jusqu'a ms_free. Renvoie 0, ou -1 si un shell est
+	             deja initialise ou en cas d'erreur d'allocation.
+	ms_run_line  execute les len premiers octets de line. Ils peuvent
+	             contenir plusieurs lignes separees par '\n', corps de
+	             here_doc compris. Renvoie le code de la derniere commande.
+	             Apres un "exit", les appels suivants ne font plus rien
+	             et renvoient le code de sortie.
+	ms_last_status  code de retour de la derniere commande ($?).
+	ms_free      libere le shell. La memoire allouee par les lignes est
+	             gardee jusque-la, comme dans le binaire.
+
+	Les gestionnaires de SIGINT/SIGQUIT de l'hote sont restaures a la fin
+	de chaque ms_run_line. L'edition de liens se fait avec -lminishell seul.
+*/
+int		ms_init(char **envp);
+int		ms_run_line(const char *line, size_t len);
+int		ms_last_status(void);
+void	ms_free(void);
+
+#endif
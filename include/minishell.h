@@ -8,8 +8,16 @@
 # include "../lib/includes/lib.h"
 # include <sys/types.h>
 # include <sys/wait.h>
+# include <sys/time.h>
+# include <sys/resource.h>
+# include <sys/stat.h>
+# include <time.h>
+# include <errno.h>
+# include <string.h>
+# include <sys/uio.h>
 # include <signal.h>
 # include <stdbool.h>
+# include <limits.h>
 
 /*   STATUS AND FLAG DEFINITIONS   */
 # define FAIL -1
@@ -64,7 +72,9 @@
 # define IGNORE_SIG_ACTION SIG_IGN
 
 /*   FILE AND STREAM CONSTANTS   */
-# define HEREDOC_TEMP_FILE "here_doc.tmp"
+# define HEREDOC_SPILL_CHUNK 4096
+# define HEREDOC_BUFFER_SIZE 65536
+# define OUTBUF_SIZE 16384
 # define OUT_FILE "Outfile"
 
 /*   PERMISSION   */
@@ -77,6 +87,25 @@ by end-of-file (wanted `EOF')\n"
 # define ERR_WRIT_NO_SPAC_LEFT_DEVC "write error: no space left on device\n"
 # define ERR_MSG_CMD_NOT_FOUND ": command not found\n"
 # define ERR_AMB_REDIRECT "minishell: ambiguous redirect\n"
+# define ERR_CD_HOME_NOT_SET "minishell: cd: HOME not set\n"
+# define ERR_CD_TOO_MANY_ARGS "minishell: cd: trop d'arguments\n"
+# define ERR_PRINTF_USAGE "minishell: printf: usage: printf format \
+[arguments]\n"
+# define ERR_READ_INVALID_OPTION "minishell: read: %s: invalid option\n\
+read: usage: read [-r] [name ...]\n"
+# define ERR_READ_INVALID_NAME "minishell: read: `%s': not a valid \
+identifier\n"
+# define ERR_ARITH "minishell: %s: %s (error token is \"%s\")\n"
+# define ERR_ARITH_DIV_ZERO "division by 0"
+# define ERR_ARITH_OPERAND "syntax error: operand expected"
+# define ERR_ARITH_SYNTAX "syntax error in expression"
+# define ERR_ARITH_PAREN "missing `)'"
+# define ERR_ARITH_COLON "`:' expected for conditional expression"
+# define ERR_ARITH_EXPONENT "exponent less than 0"
+# define ERR_ARITH_BASE "value too great for base"
+# define ERR_ARITH_RECURSION "expression recursion level exceeded"
+# define ERR_CMD_SUBST_UNCLOSED "minishell: unexpected EOF while looking for \
+matching `)'\n"
 # define ERR_MEMORY_ALLOCATION "Erreur lors de l'allocation de mémoire"
 # define WRITE_ERROR_MSG "write error"
 # define QUIT_MESSAGE "Quit\n"
@@ -122,6 +151,152 @@ value_of_expanded_var_from_env\n"
 # define CMD_PRINT_DIRCT "pwd"
 # define CMD_CHANGE_DIRECTORY "chdir"
 # define CMD_UNSET_ENV_VAR "unset"
+# define CMD_SHELLSTAT "shellstat"
+# define CMD_TEST "test"
+# define CMD_BRACKET "["
+# define CMD_PRINTF "printf"
+# define CMD_TRUE "true"
+# define CMD_FALSE "false"
+# define CMD_READ "read"
+
+/*   BUILTIN TABLE   */
+# define BUILTIN_UNRESOLVED -1
+# define BUILTIN_NONE 0
+# define BUILTIN_ECHO 1
+# define BUILTIN_CD 2
+# define BUILTIN_PWD 3
+# define BUILTIN_EXPORT 4
+# define BUILTIN_UNSET 5
+# define BUILTIN_ENV 6
+# define BUILTIN_EXIT 7
+# define BUILTIN_SHELLSTAT 8
+# define BUILTIN_TEST 9
+# define BUILTIN_BRACKET 10
+# define BUILTIN_PRINTF 11
+# define BUILTIN_TRUE 12
+# define BUILTIN_FALSE 13
+# define BUILTIN_READ 14
+# define BUILTIN_NB 15
+# define BUILTIN_HASH_SIZE 32
+# define BUILTIN_HASH_FIRST_MULT 1
+# define BUILTIN_HASH_LAST_MULT 12
+
+/*   TEST, PRINTF ET READ   */
+# define TEST_TRUE 0
+# define TEST_FALSE 1
+# define TEST_ERROR 2
+# define PRINTF_FLAGS "-+ #0"
+# define PRINTF_FLAGS_MAX 5
+# define PRINTF_WIDTH_MAX 4096
+# define PRINTF_FORMAT_SIZE 32
+# define PRINTF_NUMBER_SIZE 8256
+# define READ_CHUNK_SIZE 4096
+# define READ_LINE_MIN_CAPACITY 128
+# define READ_DEFAULT_VAR "REPLY"
+# define ENV_IFS "IFS"
+# define DEFAULT_IFS " \t\n"
+
+/*   ENV INDEX   */
+# define ENV_INDEX_MIN_CAPACITY 64
+# define ENV_INDEX_FNV_OFFSET 14695981039346656037UL
+# define ENV_INDEX_FNV_PRIME 1099511628211UL
+
+/*   ENV HOT VARS   */
+# define ENV_HOT_PWD 0
+# define ENV_HOT_OLDPWD 1
+# define ENV_HOT_HOME 2
+# define ENV_HOT_NB 3
+# define ENV_HOT_MIN_CAPACITY 256
+
+/*   EXPANSION ARITHMETIQUE   */
+# define ARITH_OPEN "$(("
+# define ARITH_OPEN_LEN 3
+# define ARITH_CLOSE_LEN 2
+# define ARITH_RESULT_SIZE 21
+# define ARITH_MAX_DEPTH 1024
+# define ARITH_PREC_MIN 1
+# define ARITH_SHIFT_MASK 63
+# define ARITH_OP_NONE -1
+# define ARITH_OP_POW 0
+# define ARITH_OP_SHL 1
+# define ARITH_OP_SHR 2
+# define ARITH_OP_LE 3
+# define ARITH_OP_GE 4
+# define ARITH_OP_EQ 5
+# define ARITH_OP_NE 6
+# define ARITH_OP_AND 7
+# define ARITH_OP_OR 8
+# define ARITH_OP_MUL 9
+# define ARITH_OP_DIV 10
+# define ARITH_OP_MOD 11
+# define ARITH_OP_ADD 12
+# define ARITH_OP_SUB 13
+# define ARITH_OP_LT 14
+# define ARITH_OP_GT 15
+# define ARITH_OP_BAND 16
+# define ARITH_OP_XOR 17
+# define ARITH_OP_BOR 18
+# define ARITH_OP_NB 19
+
+/*   SUBSTITUTION DE COMMANDE   */
+# define CMD_SUBST_OPEN "$("
+# define CMD_SUBST_OPEN_LEN 2
+# define CMD_SUBST_CLOSE_LEN 1
+# define CMD_SUBST_READ_SIZE 65536
+# define LITERAL_MARK '\001'
+
+/*   TRACE   */
+# define ENV_TRACE_FD "MINISHELL_TRACE_FD"
+# define NSEC_PER_SEC 1000000000L
+# define TRACE_SPACES 0
+# define TRACE_LEXER 1
+# define TRACE_PARSER 2
+# define TRACE_ENV 3
+# define TRACE_EXPAND 4
+# define TRACE_INIT_EXEC 5
+# define TRACE_LAUNCH 6
+# define TRACE_WAIT 7
+# define TRACE_NB_PHASE 8
+
+/*   SHELLSTAT   */
+# define STAT_FORK 0
+# define STAT_PIPE 1
+# define STAT_DUP2 2
+# define STAT_OPEN 3
+# define STAT_ACCESS 4
+# define STAT_WRITE 5
+# define STAT_ALLOC 6
+# define STAT_NB 7
+
+/*   INPUT   */
+# define INPUT_FROM_READLINE 0
+# define INPUT_FROM_READER 1
+# define INPUT_FROM_STRING 2
+# define INPUT_FROM_EMBEDDED 3
+# define SHELL_PROMPT "minishell$ "
+# define HEREDOC_PROMPT "> "
+# define COMMAND_STRING_OPTION "-c"
+# define ERR_USAGE "usage: minishell [-c command | file]\n"
+# define EXIT_SCRIPT_NOT_FOUND 127
+
+/*   HISTORY   */
+# define ENV_HISTSIZE "MINISHELL_HISTSIZE"
+# define ENV_HISTFILE "MINISHELL_HISTFILE"
+# define HISTORY_DEFAULT_SIZE 500
+# define HISTORY_DEFAULT_FILE "/.minishell_history"
+# define CTRL_P_KEY 16
+# define CTRL_R_KEY 18
+# define PERM_O_RW 0600
+
+/*   TIME KEYWORD   */
+# define TIME_KEYWORD "time"
+# define ENV_TIME_FORMAT "MINISHELL_TIME_FORMAT"
+# define TIME_FORMAT_JSON "json"
+# define USEC_PER_SEC 1000000L
+# define NSEC_PER_USEC 1000L
+# define TIME_REAL 0
+# define TIME_USER 1
+# define TIME_SYS 2
 
 /*   ENVIRONMENT VARIABLE SET   */
 # define ENV_SET_CURRENT_WORKING_DIR "PWD="
@@ -130,7 +305,7 @@ value_of_expanded_var_from_env\n"
 # define ENV_SET_PATH_PREFIX "PATH="
 
 /*   ENVIRONMENT VARIABLE NAMES   */
-# define ENV_PREVIOUS_WORKING_DIR "OLDPDW"
+# define ENV_PREVIOUS_WORKING_DIR "OLDPWD"
 # define ENV_CURRENT_WORKING_DIR "PWD"
 # define ENV_USER_HOME_DIR "HOME"
 
@@ -153,12 +328,10 @@ typedef struct s_node
 {
 	int				input_fd;
 	int				output_fd;
-	int				here_doc_fd;
 	int				is_command_present;
 	int				is_output_redirection_feasible;
 	int				is_input_redirection_failed;
 	int				output_redirection_error_id;
-	char			*heredoc_tmp_fullname;
 	struct s_node	*next;
 }	t_node;
 
@@ -181,6 +354,9 @@ typedef struct s_lexer
 	int				segment_position;
 	char			*cmd_segment;
 	t_token			token;
+	int				is_delimiter_quoted;
+	int				heredoc_fd;
+	int				builtin_id;
 	struct s_lexer	*next;
 	struct s_lexer	*prev;
 }	t_lexer;
@@ -199,6 +375,8 @@ typedef struct s_expand
 	int				var_env_match_found;
 	int				dollar_sign_present;
 	int				sing_or_doub_quote_in_env_expansion;
+	int				has_arith_error;
+	int				capacity_of_expanded_var_value;
 	char			*value_of_expanded_var_from_env;
 }	t_expand;
 
@@ -208,17 +386,86 @@ typedef struct s_export
 	struct s_export	*next_env_var_name_and_value;
 }	t_export;
 
+typedef struct s_env_index
+{
+	t_env			**slots;
+	size_t			capacity;
+	int				is_stale;
+	t_env			*hot_vars[ENV_HOT_NB];
+}	t_env_index;
+
+typedef struct s_hot_entry
+{
+	char			*buffer;
+	size_t			capacity;
+}	t_hot_entry;
+
+typedef struct s_capture
+{
+	char			*buffer;
+	size_t			len;
+	size_t			capacity;
+}	t_capture;
+
+typedef struct s_heredoc_sink
+{
+	int				pipe_fd[2];
+	int				memfd;
+	int				has_failed;
+	size_t			pipe_bytes;
+	size_t			total_bytes;
+	size_t			total_lines;
+	size_t			buffer_len;
+	char			buffer[HEREDOC_BUFFER_SIZE];
+}	t_heredoc_sink;
+
+typedef struct s_outbuf
+{
+	int				fd;
+	int				has_failed;
+	size_t			len;
+	char			buffer[OUTBUF_SIZE];
+}	t_outbuf;
+
+typedef struct s_time_report
+{
+	int				is_pipeline_timed;
+	int				nb_timed_stage;
+	char			**stage_name;
+	struct rusage	*stage_usage;
+	struct rusage	shell_usage_start;
+	struct timespec	wall_start;
+}	t_time_report;
+
+typedef struct s_trace
+{
+	int				fd;
+	struct timespec	start;
+	struct timespec	mark;
+	long			phase_ns[TRACE_NB_PHASE];
+	size_t			nb_heredoc;
+	size_t			heredoc_bytes;
+	size_t			heredoc_lines;
+}	t_trace;
+
+typedef struct s_shellstat
+{
+	unsigned long	total[STAT_NB];
+	unsigned long	line_start[STAT_NB];
+	unsigned long	last_line[STAT_NB];
+}	t_shellstat;
+
 typedef struct s_exec
 {
 	int				heredoc_ctrl_c_uninterrupted;
-	int				heredoc_nbr;
 	int				stdin_fd_for_heredoc;
 	int				is_this_an_exec_in_heredoc;
 	int				nb_cmd_in_lst;
 	int				cmd_nb_pipe;
 	int				previous_fd;
+	int				is_last_stage_run_in_parent;
+	unsigned int	last_stage_status;
 	char			**full_env_var_copy_beta;
-	char			*heredoc_input_buffer;
 	char			*g_signal_in_char_format;
 	char			*name_of_var_env_to_del;
 	t_env			*linked_list_full_env_var_copy_alpha;
@@ -226,11 +473,42 @@ typedef struct s_exec
 	t_node			*head_cmd_lst;
 	t_lexer			*head_lexer_lst;
 	t_export		*head_of_linked_list_env_var;
+	t_time_report	time_report;
+	t_heredoc_sink	heredoc_sink;
+	t_outbuf		outbuf;
+	t_trace			trace;
+	t_env_index		env_index;
+	t_hot_entry		hot_entries[ENV_HOT_NB];
+	t_hot_entry		logical_pwd;
+	t_capture		cmd_subst;
 	struct s_node	*node;
 	struct s_exec	*next;
 	struct s_exec	*prev;
 }	t_exec;
 
+typedef struct s_input
+{
+	int				source;
+	int				is_regular_file;
+	int				is_closed;
+	pid_t			embedder_pid;
+	off_t			released_offset;
+	t_reader		reader;
+	char			*str;
+	size_t			str_pos;
+	char			*(*read_line)(const char *prompt);
+	void			(*on_prompt_sigint)(int sig);
+}	t_input;
+
+typedef struct s_history
+{
+	int				is_loaded;
+	int				fd;
+	int				max_size;
+	char			*path;
+	char			*last_line;
+}	t_history;
+
 typedef struct s_trash_memory
 {
 	void					*add;
@@ -242,6 +520,7 @@ typedef struct s_data
 	int				env_var_line_idx;
 	int				is_sing_quot;
 	int				is_doub_quot;
+	int				is_tail_exec_allowed;
 	int				command_line_arg_count;
 	int				input_line_word_count;
 	char			*minishell_input_cmd;
@@ -253,16 +532,91 @@ typedef struct s_data
 	t_expand		*expand;
 	t_lexer			*lexer_list;
 	t_trash_memory	*trash_memory;
-
+	t_trash_memory	*env_memory;
+	t_trash_memory	*line_mark;
+	t_input			input;
+	t_history		history;
 }	t_data;
 
+typedef struct s_builtin
+{
+	const char	*name;
+	void		(*run)(t_lexer *lexer_lst, int *fd, t_data *data);
+}	t_builtin;
+
+typedef struct s_test
+{
+	char			*name;
+	char			**argv;
+	int				argc;
+	int				pos;
+	int				status;
+}	t_test;
+
+typedef struct s_printf_spec
+{
+	char			flags[PRINTF_FLAGS_MAX + 1];
+	int				width;
+	int				precision;
+	char			conv;
+}	t_printf_spec;
+
+typedef struct s_printf
+{
+	t_outbuf		*out;
+	char			*format;
+	char			**args;
+	int				nb_args;
+	int				index;
+	int				status;
+	int				is_stopped;
+}	t_printf;
+
+typedef struct s_read_line
+{
+	char			*buffer;
+	char			*is_escaped;
+	size_t			len;
+	size_t			capacity;
+	int				fd;
+	int				is_raw;
+	int				is_seekable;
+	int				has_backslash;
+}	t_read_line;
+
+typedef struct s_arith_op
+{
+	const char		*token;
+	int				precedence;
+}	t_arith_op;
+
+typedef struct s_arith
+{
+	t_data			*data;
+	const char		*expr;
+	const char		*error;
+	size_t			pos;
+	size_t			error_pos;
+	size_t			operand_pos;
+	int				depth;
+	int				noeval;
+}	t_arith;
+
 extern unsigned int	g_globi;
 
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 /*                                  MAIN                                     */
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 
-/*   Fonctions de main.c   */
+/*   Fonctions de shell_init.c   */
+void		init_data(t_data *data, int ac, char **av, char **env);
+int			exit_error(char *str, t_data *data);
+void		exit_shell_process(t_data *data, int exit_code);
+char		**get_new_env(t_data *data, t_env *env_lst);
+
+/*   Fonctions de prompt_loop.c   */
+bool		parse_command_line(char *tmp, t_data *data);
+void		execute_command_line(t_data *data);
 void		prompt_loop(char *tmp, t_data *data, char **env);
 
 /*   Fonctions de main_utils.c   */
@@ -277,6 +631,11 @@ char		*add_spaces_around_operators(t_data *data, const char *command);
 /*                                BUILT_IN                                   */
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 
+/*   Fonctions de builtin_args.c   */
+int			count_builtin_args(t_lexer *lexer_lst);
+char		**collect_builtin_args(t_lexer *lexer_lst, t_data *data, int *argc);
+int			get_builtin_input_fd(t_data *data);
+
 /*   Fonctions de built_in_utils_2.c   */
 int			ft_string_length(char *s);
 char		*ft_strjoin_with_memory_tracking(char *s1, char *s2, t_data *data);
@@ -292,23 +651,21 @@ char		*case_egale(char *str, t_data *data);
 void		exit_all(t_data *data);
 
 /*   Fonctions de cd.c   */
-int			verif_pwd(char *str, t_data *data);
-int			verif_home(char *str, t_data *data);
-int			change_directory_for_home(t_env *tmp, t_data *data);
-char		*get_home(t_env *tmp, t_data *data);
-
-/*   Fonctions de cd2.c   */
-int			change_directory_for_pwd(t_env *tmp, t_data *data);
+t_lexer		*find_cd_operand(t_lexer *lexer_lst);
 int			wrong_cd(t_lexer *lexer_lst);
-int			cd_with_arg(t_data *data, char *path, char *old, int *i);
-char		*create_new_var(char *str, t_data *data);
 void		get_cd(t_lexer *lexer_lst, t_data *data);
 
+/*   Fonctions de cd2.c   */
+void		update_working_directory(t_data *data, char *path);
+void		record_physical_directory(t_data *data);
+int			change_directory(t_data *data, char *dir);
+
 /*   Fonctions de cd3.c   */
-int			change_directory(char *dir);
-int			change_directory_for_oldpwd(t_env *tmp, t_data *data);
-int			verif_oldpwd(char *str, t_data *data);
-char		*get_pwd_env(t_env *tmp, t_data *data);
+void		append_path_components(char *path, size_t *len, const char *src);
+char		*build_logical_path(t_data *data, const char *dir);
+int			set_logical_pwd(t_data *data, t_exec *utils, const char *path);
+bool		is_valid_logical_pwd(t_env *pwd);
+void		init_logical_pwd(t_data *data, t_exec *utils);
 
 /*   Fonctions de echo_utils.c   */
 int			ft_word_count(char *s, char c);
@@ -319,10 +676,9 @@ void		freetab(char **tab, int k);
 
 /*   Fonctions de echo.c   */
 int			ft_strcmp(char *s1, char *s2);
-void		display_echo_arg(char **tab, int i, t_data *data);
+void		display_echo_arg(char **tab, int i, t_outbuf *out);
 void		get_words(t_lexer *lexer_lst, char **tab, int *i);
-void		process_echo(char **tab, int i, t_data *data);
-void		procc_in_echo_std(char **tab, int i, t_data *data);
+void		process_echo(char **tab, int i, t_outbuf *out);
 
 /*   Fonctions de echo2.c   */
 int			check_n(char *str);
@@ -372,11 +728,11 @@ void		remove_double_quotes(char *str);
 /*   Fonctions de export_var_exist.c   */
 int			verif_var_exist_export(t_exec *utils, char *str, t_data *data);
 int			verif_equal(char *str, char c);
-int			verif_var_exist(t_exec *utils, char *str);
+int			verif_var_exist(t_exec *utils, char *str, t_data *data);
 int			verif_var_exist_export_not_maj(t_exec *utils, char *str);
 
 /*   Fonctions de export.c   */
-int			export_parsing_syntaxe(t_lexer *tmp, t_data *data);
+int			export_parsing_syntaxe(t_lexer *tmp);
 int			export_things(t_lexer *lexer_lst, t_data *data);
 void		print_export(t_export *head_of_linked_list_env_var, t_data *data);
 void		process_word_and_add_export(t_lexer *tmp, t_data *data);
@@ -385,7 +741,7 @@ void		export_remaining(t_lexer *tmp, t_data *data);
 /*   Fonctions de ft_exit.c   */
 int			is_valid_number2(int neg, char *str, int i);
 int			is_valid_number(char *str);
-void		free_res(int *fd, t_data *data);
+void		leave_shell(int *fd, t_data *data, unsigned char exit_code);
 void		ft_exit_with_code( \
 			t_lexer *lex, int *fd, unsigned char exit_code, t_data *data);
 void		ft_exit(t_lexer *lex, int *fd, t_data *data);
@@ -394,19 +750,112 @@ void		ft_exit(t_lexer *lex, int *fd, t_data *data);
 int			verif_oldpwd_export(char *str, t_data *data);
 int			verif_pwd_export(char *str, t_data *data);
 
+/*   Fonctions de printf.c   */
+long long	parse_printf_number(t_printf *pf, char *arg);
+void		write_printf_pass(t_printf *pf, const char *format);
+void		ft_printf_builtin(t_lexer *lexer_lst, t_data *data);
+
+/*   Fonctions de printf_escape.c   */
+int			parse_printf_digits(\
+			const char *str, int base, int max_digits, int *value);
+char		get_printf_escape_char(char c);
+int			write_printf_numeric_escape(\
+			t_printf *pf, const char *str, int is_arg);
+int			write_printf_escape(t_printf *pf, const char *str, int is_arg);
+void		write_printf_escaped_arg(t_printf *pf, const char *arg);
+
+/*   Fonctions de printf_float.c   */
+double		parse_printf_double(t_printf *pf, char *arg);
+void		write_printf_float(t_printf *pf, t_printf_spec *spec, char *arg);
+
+/*   Fonctions de printf_spec.c   */
+int			parse_printf_bound(const char *str, int *i);
+int			parse_printf_spec(const char *str, t_printf_spec *spec);
+void		write_printf_string(t_printf *pf, t_printf_spec *spec, \
+			const char *str, int len);
+void		write_printf_number(t_printf *pf, t_printf_spec *spec, char *arg);
+int			write_printf_conversion(t_printf *pf, const char *str);
+
+/*   Fonctions de printf_utils.c   */
+void		init_printf(t_printf *pf, char **argv, int argc);
+char		*next_printf_arg(t_printf *pf);
+void		report_printf_error(t_printf *pf, char *arg, char *msg);
+int			get_printf_string_length(t_printf_spec *spec, char *arg);
+int			stop_printf_on_bad_conversion(\
+			t_printf *pf, const char *str, int i);
+
 /*   Fonctions de pwd.c   */
 int			get_pwd(char *tab, t_data *data);
+void		write_pwd_line(t_data *data, char *path);
 void		display_pwd(t_data *data);
 void		display_pwd_error(t_data *data);
-void		find_old_pwd(t_env *env, t_data *data);
+
+/*   Fonctions de read.c   */
+int			parse_read_options(char **argv, t_read_line *line);
+int			check_read_names(char **names);
+void		assign_read_var(\
+			t_data *data, char *name, const char *value, size_t len);
+void		ft_read(t_lexer *lexer_lst, t_data *data);
+
+/*   Fonctions de read_condition.c   */
+bool		is_read_ifs(t_read_line *line, const char *ifs, size_t i);
+bool		is_read_ifs_space(t_read_line *line, const char *ifs, size_t i);
+bool		is_valid_read_name(const char *name);
+
+/*   Fonctions de read_line.c   */
+void		init_read_line(t_read_line *line, int fd);
+void		free_read_line(t_read_line *line);
+int			push_read_char(t_read_line *line, char c, int is_escaped);
+ssize_t		process_read_chunk(\
+			t_read_line *line, const char *chunk, ssize_t n);
+int			read_builtin_line(t_read_line *line);
+
+/*   Fonctions de read_split.c   */
+size_t		skip_read_ifs_spaces(\
+			t_read_line *line, const char *ifs, size_t pos);
+size_t		find_read_field_end(\
+			t_read_line *line, const char *ifs, size_t pos);
+size_t		skip_read_delimiter(\
+			t_read_line *line, const char *ifs, size_t pos);
+void		assign_read_fields(t_data *data, t_read_line *line, char **names);
+
+/*   Fonctions de shellstat.c   */
+void		write_stat_number(t_outbuf *out, unsigned long nb);
+char		*get_stat_name(int id);
+void		write_shellstat_row(t_outbuf *out, char *label, unsigned long *nb);
+void		ft_shellstat(t_data *data);
+
+/*   Fonctions de test.c   */
+void		report_test_error(t_test *test, char *arg, char *msg);
+int			init_test(t_test *test, char **argv, int argc);
+void		ft_test(t_lexer *lexer_lst, t_data *data);
+
+/*   Fonctions de test_compare.c   */
+int			eval_test_unary(char op, char *arg);
+int			parse_test_integer(t_test *test, char *arg, long long *value);
+int			compare_test_integers(char *op, long long left, long long right);
+int			eval_test_binary(t_test *test, char *left, char *op, char *right);
+
+/*   Fonctions de test_condition.c   */
+bool		is_test_word(t_test *test, int pos, char *word);
+bool		is_test_unary_op(char *arg);
+bool		is_test_binary_op(char *arg);
+bool		is_binary_test_at(t_test *test, int pos);
+bool		is_test_file_type(char op, struct stat *st);
+
+/*   Fonctions de test_expr.c   */
+int			eval_test_or(t_test *test);
+int			eval_test_and(t_test *test);
+int			eval_test_not(t_test *test);
+int			eval_test_group(t_test *test);
+int			eval_test_primary(t_test *test);
 
 /*   Fonctions de write_echo.c   */
-int			procc_in_echo_fd(char **tab, int i, int j, t_data *data);
-void		write_echo_fd(char **tab, int i, t_data *data);
+void		write_echo_words_skipping_n(char **tab, int i, t_outbuf *out);
+void		write_echo_words(char **tab, int i, t_outbuf *out);
 
 /*   Fonctions divers de built_in   */
 char		*ft_strjoin2_mini(char *s1, char *s2, t_data *data);
-char		*get_old_pwd(t_env *tmp, t_data *data);
 void		execute_lexer_command_with_args(t_data *data);
 void		ft_putstr_fd_mini(char *s1, char *s2, int fd, t_data *data);
 
@@ -424,6 +873,7 @@ void		exec_cmd_with_redirection_and_builtins(\
 			t_data	*data, int *fd, int count, t_exec utils);
 pid_t		create_and_execute_child_process(\
 			t_data	*data, int *fd, int count, t_exec utils);
+void		exec_tail_cmd_in_place_of_shell(t_data *data, int *fd, int count);
 
 /*   Fonctions de close_pipes_and_fds.c   */
 int			closes_ends_of_pipe(int *fd);
@@ -433,19 +883,44 @@ int			close_file_descriptors_in_linked_list(t_data *data);
 bool		is_pipe_creation_failed(int *fd, int total_number_of_cmd);
 bool		is_single_command_in_list(t_data *data);
 bool		is_single_builtin_command(t_data *data);
+bool		is_last_stage_builtin_for_parent(t_data *data, int count);
+bool		is_tail_exec_possible(t_data *data);
 
 /*   Fonctions de cmd_path_resltion_condtion.c   */
 bool		is_env_var_path_name(t_env *env);
 bool		is_invalid_direct_path(const char *cmd);
 
 /*   Fonctions de command_analysis.c   */
-int			is_cmd_match( \
-			t_lexer *lexer_lst, const char *command, int command_length);
 int			is_built_in_command(t_lexer *lexer_lst);
 int			should_continue_execution(t_data *data, int *y);
 int			check_redirection_validity_in_node(t_node *node);
 t_lexer		*find_next_command_in_lexer(t_lexer *lexer_list);
 
+/*   Fonctions de builtin_table.c   */
+const t_builtin	*get_builtin_table(void);
+int			hash_builtin_name(const char *name, size_t len);
+int			find_builtin_id(const char *name);
+int			get_builtin_id(t_lexer *lexer_lst);
+int			tag_builtin_id(const char *word);
+
+/*   Fonctions de builtin_run.c   */
+void		run_echo(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_cd(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_pwd(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_export(t_lexer *lexer_lst, int *fd, t_data *data);
+
+/*   Fonctions de builtin_run_2.c   */
+void		run_unset(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_exit(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_shellstat(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_test(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_printf(t_lexer *lexer_lst, int *fd, t_data *data);
+
+/*   Fonctions de builtin_run_3.c   */
+void		run_true(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_false(t_lexer *lexer_lst, int *fd, t_data *data);
+void		run_read(t_lexer *lexer_lst, int *fd, t_data *data);
+
 /*   Fonctions de command_execution_condtion.c   */
 bool		is_pid_array_null(pid_t *pid);
 bool		is_process_pid_valid_for_wait(pid_t pid);
@@ -480,11 +955,44 @@ bool		is_not_last_command_and_fd_open(int count, int total_cmds, int fd);
 void		configure_stdout_redirection_for_command( \
 			t_exec utils, int *fd, int count);
 
+/*   Fonctions de time_keyword_condition.c   */
+bool		is_time_keyword(t_lexer *lexer);
+bool		is_pipeline_timed(t_data *data);
+bool		is_json_time_format_requested(t_data *data);
+
+/*   Fonctions de time_keyword.c   */
+void		promote_first_argument_to_command(t_lexer *lexer);
+void		strip_time_keyword(t_data *data);
+void		start_time_report(t_data *data);
+void		name_timed_stage(t_data *data, int stage);
+void		wait_child_process(\
+			pid_t pid, int *wstatus, t_data *data, int stage);
+
+/*   Fonctions de time_report.c   */
+void		print_usec_as_seconds(char *label, long usec);
+void		print_timed_stage_human(t_time_report *report, int stage);
+void		print_time_report_human(t_time_report *report, long *totals);
+void		print_time_report_json(\
+			t_time_report *report, long *totals, t_data *data);
+void		print_time_report(t_data *data);
+
+/*   Fonctions de time_report_utils.c   */
+long		timeval_to_usec(struct timeval tv);
+long		elapsed_wall_usec(struct timespec start);
+void		sum_time_report_usage(t_time_report *report, long *totals);
+int			write_json_control_escape(char *dst, char c);
+char		*escape_json_string(char *str, t_data *data);
+
+/*   Fonctions de last_stage_builtin.c   */
+void		exec_last_stage_builtin_in_parent(\
+			t_data *data, int *fd, int count);
+
 /*   Fonctions de pipe_cmd_management_and_init_vars.c  */
 int			count_args_until_pipe_for_cmd_array(t_lexer *lexer_list);
 void		initialize_pid_array_to_zero(pid_t *pid_array, int num_nodes);
 void		init_fd_and_status_vars(int *fd, int *y, int *wstatus);
 t_lexer		*reaches_next_cmd_preceded_by_pipe(t_lexer *lexer_list);
+void		exec_pipeline_stage(t_data *data, int *fd, pid_t *pid, int *y);
 
 /*   Fonctions de pipe_cmd_management_and_init_vars_condition.c   */
 bool		is_current_token_cmd_arg(t_lexer *lexer_lst);
@@ -502,6 +1010,70 @@ bool		is_env_list_empty_or_null(t_env *env_lst);
 /*                                EXPANDER                                   */
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 
+/*     Fonctions de arith_condition.c    */
+bool		is_arith_unary_operator(char c);
+bool		is_arith_name_start(char c);
+bool		is_arith_name_char(char c);
+int			get_arith_digit_value(char c);
+int			is_arith_short_circuit(int op, long long lhs);
+
+/*     Fonctions de arith_eval.c    */
+long long	parse_arith_expression(t_arith *ar);
+long long	parse_arith_ternary(t_arith *ar);
+long long	parse_arith_branches(t_arith *ar, long long cond);
+long long	parse_arith_binary(t_arith *ar, int min_precedence);
+int			peek_arith_operator(t_arith *ar);
+
+/*     Fonctions de arith_expansion.c    */
+size_t		get_arith_expansion_length(const char *str);
+void		append_arith_result(t_expand *exp, long long value);
+bool		evaluate_arith(t_data *data, const char *expr, long long *result);
+long long	evaluate_arith_value(t_arith *ar, const char *value);
+int			expand_arith_expression(\
+			char *w, size_t len, t_expand *exp, t_data *data);
+
+/*     Fonctions de arith_operand.c    */
+long long	parse_arith_unary(t_arith *ar);
+long long	parse_arith_primary(t_arith *ar);
+long long	parse_arith_group(t_arith *ar);
+long long	parse_arith_number(t_arith *ar);
+long long	parse_arith_variable(t_arith *ar);
+
+/*     Fonctions de arith_operators.c    */
+const t_arith_op	*get_arith_operators(void);
+long long	apply_arith_operator(\
+			t_arith *ar, int op, long long lhs, long long rhs);
+long long	apply_arith_bitwise(int op, long long lhs, long long rhs);
+long long	compare_arith(int op, long long lhs, long long rhs);
+long long	apply_arith_unary(char op, long long value);
+
+/*     Fonctions de arith_utils.c    */
+void		skip_arith_spaces(t_arith *ar);
+long long	set_arith_error(t_arith *ar, const char *message, size_t pos);
+void		report_arith_error(t_arith *ar);
+long long	divide_arith(t_arith *ar, int op, long long lhs, long long rhs);
+long long	power_arith(t_arith *ar, long long base, long long exponent);
+
+/*     Fonctions de cmd_subst.c    */
+size_t		get_cmd_subst_length(const char *str);
+t_lexer		*parse_cmd_subst_plan(t_data *data, char *inner);
+void		run_cmd_subst_child(t_data *data, t_lexer *plan, int *fd);
+bool		run_cmd_subst(t_data *data, t_lexer *plan);
+bool		capture_cmd_subst(t_data *data, const char *w, size_t len);
+
+/*     Fonctions de cmd_subst_expand.c    */
+bool		reserve_expanded_word(t_expand *exp, t_data *data, size_t extra);
+void		append_cmd_subst_output(t_expand *exp, t_data *data, int is_quoted);
+int			expand_command_subst(\
+			char *w, t_expand *exp, t_data *data, t_quote *state);
+long long	parse_arith_cmd_subst(t_arith *ar);
+
+/*     Fonctions de cmd_subst_utils.c    */
+bool		reserve_cmd_subst_buffer(\
+			t_data *data, t_capture *capture, size_t size);
+void		read_cmd_subst_output(t_data *data, int fd);
+void		wait_cmd_subst_child(pid_t pid);
+
 /*     Fonctions de char_validation_utils.c    */
 bool		is_next_char_valid_and_not_single_quote(const char *word, \
 			int *indx);
@@ -515,17 +1087,6 @@ int			is_only_single_quote_on(t_quote *state);
 int			is_only_double_quote_on(t_quote *state);
 int			is_both_quotes_on(t_quote *state);
 
-/*     Fonctions de env_var_expansion_length.c     */
-int			get_env_var_expansion_length(\
-			char *word, int *length, char *env_var, t_quote *state);
-int			calculate_length_for_env_expansion(char *word, \
-			char **env_var, t_quote *state, int *length);
-int			calculate_expanded_env_var_length(\
-			char *word, char **env_var, t_quote *state, int *length);
-int			calculate_length_until_single_quote(char *word, int *length);
-bool		is_char_matching_env_var(\
-			char *word, int word_index, char *env_var, int env_var_index);
-
 /*     Fonctions de expand_utils.c     */
 int			length_of_number_for_string_conversion(long n);
 int			is_decimal_digit(char c);
@@ -557,6 +1118,7 @@ void		length_of_env_variable_value(\
 /*     Fonctions de expansion_search_utils.c   */
 int			find_and_expand_env_var_with_special_char( \
 			char *w, t_expand *exp, t_data *data, t_quote *state);
+int			length_of_expansion_name(char *name, t_quote *state);
 int			handle_unfound_expansion_word(char *w, t_quote *state);
 
 /*     Fonctions de expansion_validation_utils.c   */
@@ -578,7 +1140,7 @@ bool		is_dollar_char_then_end_of_string(t_lexer *exp);
 
 /*     Fonctions de lexeme_expansion_and_manipulation.c   */
 char		*allocate_memory_for_expanded_word(\
-			t_lexer **exp, t_quote *st, char **env, t_data *data);
+			t_lexer **exp, t_quote *st, int *capacity, t_data *data);
 void		expand_and_insert_in_lexeme_linked_list(\
 			t_lexer **expnd, t_quote *st, t_data *data, t_expand *exp);
 void		insert_additional_lexemes(\
@@ -594,6 +1156,7 @@ bool		is_char_non_space_and_copyable(char current_char);
 bool		is_next_char_non_space(char *word, int index);
 bool		is_next_char_present(char *word, int index);
 bool		is_start_of_word(char *word, int index);
+bool		is_literal_mark(char *word);
 
 /*     Fonctions de malloc_expand.c    */
 char		*malloc_copy_string_excluding_inactive_quotes(\
@@ -627,13 +1190,6 @@ bool		is_double_quote_with_single_quote_closed(\
 			char current_char, t_quote *state);
 bool		is_quote_char_with_closed_state(char current_char, t_quote *state);
 
-/*     Fonctions de shell_variable_handling_env_condition.c  */
-bool		is_matching_env_var_name(\
-			char *w, t_data *data, int i, int env_var_char_idx);
-bool		is_valid_env_var_entry(t_data *data);
-bool		is_env_var_value_non_empty(t_data *data, int env_var_char_idx);
-bool		is_env_var_name_with_equal_sign(t_data *data, int env_var_char_idx);
-
 /*     Fonctions de shell_word_expansion_conditions.c   */
 bool		is_expansion_not_required_and_quoted(t_expand *exp);
 bool		is_singl_or_doubl_quote(char character);
@@ -646,7 +1202,7 @@ int			determine_expansion_or_quote_removal(\
 			t_lexer **to_check, t_quote *state, t_expand *exp, t_data *data);
 void		process_lexer_for_expansion(\
 			t_quote *state, t_data *data, t_expand *exp, t_lexer *lexeme);
-void		expand(t_quote *state, char **env, t_lexer *tmp, t_data *data);
+bool		expand(t_quote *state, char **env, t_lexer *tmp, t_data *data);
 
 /*     Fonctions de singular_quote_status_utils.c     */
 int			is_single_quote_open(t_quote *state);
@@ -657,8 +1213,6 @@ int			is_doubl_quote_closed(t_quote *state);
 /*     Fonctions de special_char_handling.c     */
 int			is_next_char_end_or_special(char *word, t_quote *state);
 int			is_next_char_decimal_digit(char *word);
-int			is_special_char_found_with_state_not_found(\
-			t_lexer *exp, t_quote *state, int index);
 int			is_next_char_question_mark(t_lexer *exp, int index);
 
 /*     Fonctions de special_character_checks.c    */
@@ -669,6 +1223,7 @@ int			is_dollar_at_end(char *str);
 /*     Fonctions de split_word_by_quotes.c     */
 int			count_subwords_with_quote_states(char *word, t_quote *state);
 char		**split_word_by_quotes(t_data *data, char *word, t_quote *state);
+int			get_literal_step(char *word);
 
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 /*                                   FREE                                    */
@@ -681,6 +1236,19 @@ void		*malloc_track(t_data *data, size_t size);
 void		ft_free(void *add, t_data *date);
 void		ft_free_all(t_data *data);
 
+/*     Fonctions de env_memory.c    */
+void		keep_env_memory(t_data *data, void *add);
+void		drop_env_memory(t_data *data, void *add);
+void		release_env_value(t_data *data, char *value);
+void		release_trash_until(t_data *data, t_trash_memory *mark);
+void		free_trash_list(t_trash_memory *list);
+
+/*     Fonctions de env_memory_utils.c    */
+bool		move_trash_node(t_trash_memory **from, t_trash_memory **to, \
+void *add, t_trash_memory *stop);
+bool		is_env_value_in_use(t_exec *utils, char *value);
+void		replace_env_value(t_data *data, char **slot, char *value);
+
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 /*                                INIT_ENV                                   */
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
@@ -691,6 +1259,38 @@ void		ft_env_lst_add_to_end(t_env *lst, t_env *new);
 t_env		*create_and_init_env_var_node(t_data *data, char *env);
 t_env		*create_env_list_from_array(t_data *data, char **env);
 
+/*     Fonctions de env_index.c    */
+void		mark_env_index_stale(t_exec *utils);
+size_t		hash_env_name(const char *name, size_t len);
+void		insert_env_index_slot(t_env_index *index, t_env *env);
+bool		grow_env_index(t_env_index *index, size_t capacity);
+int			rebuild_env_index(t_exec *utils);
+
+/*     Fonctions de env_index_utils.c    */
+t_env		*find_env_var_linear(t_exec *utils, const char *name, size_t len);
+void		init_env_index(t_exec *utils);
+void		free_env_index(t_exec *utils);
+size_t		count_env_vars(t_env *env);
+
+/*     Fonctions de env_hot_vars.c    */
+char		*get_env_hot_name(int id);
+t_env		*probe_env_index(t_env_index *index, const char *name, size_t len);
+void		refresh_env_hot_vars(t_env_index *index);
+t_env		*get_env_hot_var(t_data *data, int id);
+int			reserve_hot_entry(t_data *data, t_hot_entry *entry, size_t size);
+
+/*     Fonctions de env_hot_vars_utils.c    */
+void		init_hot_entries(t_exec *utils);
+char		*find_env_hot_value(t_data *data, int id);
+int			set_env_hot_value(t_data *data, int id, const char *value);
+
+/*     Fonctions de env_lookup.c    */
+size_t		env_entry_name_length(const char *entry);
+bool		is_env_entry_named(t_env *env, const char *name, size_t len);
+t_env		*find_env_var(t_data *data, const char *name, size_t len);
+char		*find_env_value(t_data *data, const char *name, size_t len);
+char		*get_env_var_value(t_data *data, char *name);
+
 /*     Fonctions de init_env.c   */
 void		malloc_no_env_initial_node(t_data *data, char *str, t_env **env);
 t_env		*init_env_list_with_pwd_if_empty(t_data *data, t_env *final);
@@ -703,32 +1303,46 @@ t_exec		*init_env(t_data *data, char **env);
 /*   Fonctions de file_flags.c   */
 int			out_to_file_flags(void);
 int			append_to_file_flags(void);
-int			heredoc_tmp_file_flags(void);
+int			history_file_flags(void);
 
 /*   Fonctions de here_doc_2.c   */
-int			is_backslash_at_end(char *str);
-int			is_escaped(char *line, int index);
-char		*get_variable_value(char *var_name, t_data *data);
-void		write_line_to_heredoc(char *line, int heredoc_fd);
-void		remove_escape_character(char **line, int index);
+void		write_line_to_heredoc(char *line, t_heredoc_sink *sink);
+void		append_heredoc_exit_status(t_heredoc_sink *sink);
+size_t		append_heredoc_variable(\
+			char *line, size_t start, t_data *data, t_heredoc_sink *sink);
 
 /*   Fonctions de here_doc_3.c   */
-void		manage_here_doc_process(t_node *node, t_lexer *lexer_lst, \
-			t_data *data);
+bool		is_heredoc_present_in_lexer_list(t_lexer *lexer_lst);
+int			collect_heredoc_body(t_lexer *lexer_lst, t_data *data);
+void		discard_collected_heredocs(t_lexer *lexer_lst);
+void		collect_heredocs_before_exec(t_data *data);
+
+/*   Fonctions de heredoc_sink.c   */
+int			open_heredoc_sink(t_heredoc_sink *sink);
+int			spill_heredoc_sink_to_memfd(t_heredoc_sink *sink);
+void		write_heredoc_sink(\
+			t_heredoc_sink *sink, const char *buf, size_t len);
+int			close_heredoc_sink(t_heredoc_sink *sink);
+
+/*   Fonctions de heredoc_sink_utils.c   */
+int			write_all_to_fd(int fd, const char *buf, size_t len);
+ssize_t		write_heredoc_sink_pipe(\
+			t_heredoc_sink *sink, const char *buf, size_t len);
+void		flush_heredoc_sink(t_heredoc_sink *sink);
+void		append_heredoc_sink(\
+			t_heredoc_sink *sink, const char *buf, size_t len);
 
 /*   Fonctions de here_doc_condition.c   */
 bool		is_heredoc_delimiter_matched(char *delimiter, char *line);
-bool		is_heredoc_ended_by_signal(t_data *data);
-bool		is_heredoc_interrupted_for_stdin_restore(t_data *data);
-bool		is_heredoc_file_opening_failed(int file_descriptor);
+bool		is_heredoc_interrupted_by_signal(char *line);
 bool		is_valid_variable_char(char c);
+bool		is_heredoc_escapable_char(char c);
+bool		is_heredoc_expansion_start(char c);
 
 /*   Fonctions de here_doc.c   */
-char		*extract_and_get_var_value(char **line, int var_name_start, \
-			int var_name_length, t_data *data);
-void		expand_variable(char **line, int index, t_data *data);
-void		process_heredoc_line(char **line, t_data *data);
-void		ft_read_input(t_node *node, t_lexer *lexer_lst, t_data *data);
+void		expand_heredoc_line(char *line, t_data *data, t_heredoc_sink *sink);
+int			ft_read_input(\
+			t_lexer *lexer_lst, t_data *data, t_heredoc_sink *sink);
 
 /*   Fonctions de init_exec_utils_condition.c   */
 bool		is_first_input_redirection_error(t_node *node);
@@ -779,9 +1393,7 @@ bool		is_output_fd_open_for_closing(t_node *node);
 
 /*   Fonctions de init_fd_heredoc_condition.c  */
 bool		is_here_doc_followed_by_delimiter(t_lexer *lexer_lst);
-bool		is_heredoc_tmp_file_exists(t_node *node);
-void		configure_here_doc_input(\
-			t_node *node, t_lexer *lex_lst, t_data *data);
+void		configure_here_doc_input(t_node *node, t_lexer *lex_lst);
 
 /*   Fonctions de init_fd_redirect_condition.c  */
 bool		is_redirect_out_followed_by_fd_token(t_lexer *lex_lst);
@@ -799,8 +1411,7 @@ bool		is_next_word_missing(t_lexer *lexer_lst);
 bool		is_next_lexeme_word_existing(t_lexer *lex_lst);
 
 /*   Fonctions de init_fd.c   */
-void		setup_input_redirection(\
-			t_node *node, t_lexer *lexer_lst, t_data *data);
+void		setup_input_redirection(t_node *node, t_lexer *lexer_lst);
 void		append_output_redirection(\
 			t_node *node, t_lexer *lex_lst, \
 			int *is_output_redirection_feasible);
@@ -808,6 +1419,119 @@ void		normal_output_redirection(t_node *node, t_lexer *lex_lst);
 void		setup_output_redirection(t_node *node, t_lexer *lexer_lst);
 bool		is_next_command_segment_present(t_lexer *lex_lst);
 
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                  TRACE                                    */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+/*   Fonctions de trace.c   */
+int			get_trace_fd(t_data *data);
+void		trace_heredoc_stats(t_data *data, t_heredoc_sink *sink);
+
+/*   Fonctions de trace_phase.c   */
+long		elapsed_trace_ns(struct timespec *from, struct timespec *to);
+void		start_line_trace(t_data *data);
+void		mark_trace_phase(t_data *data, int phase);
+void		emit_line_trace(t_data *data);
+bool		is_line_traced(t_data *data);
+
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                   API                                     */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+/*   Fonctions de libminishell_utils.c   */
+t_data		**get_embedded_shell(void);
+void		run_embedded_lines(t_data *data);
+void		save_host_signals(struct sigaction *saved);
+void		restore_host_signals(struct sigaction *saved);
+
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                  STATS                                    */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+/*   Fonctions de shell_stats.c   */
+t_shellstat	*get_shell_stats(t_shellstat *stats);
+void		init_shell_stats(void);
+void		count_shell_stat(int id);
+void		begin_line_stats(void);
+void		end_line_stats(void);
+
+/*   Fonctions de counted_syscalls.c   */
+pid_t		ft_fork(void);
+int			ft_pipe(int *fd, int flags);
+int			ft_dup2(int old_fd, int new_fd);
+int			ft_open(const char *path, int flags, mode_t mode);
+int			ft_access(const char *path, int mode);
+
+/*   Fonctions de counted_write.c   */
+ssize_t		ft_write(int fd, const void *buf, size_t len);
+
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                  OUTPUT                                   */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+/*   Fonctions de outbuf.c   */
+t_outbuf	*start_builtin_output(t_data *data);
+void		flush_outbuf(t_outbuf *out);
+void		write_outbuf(t_outbuf *out, const char *str, size_t len);
+void		puts_outbuf(t_outbuf *out, const char *str);
+void		finish_builtin_output(t_data *data);
+
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                  INPUT                                    */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+/*   Fonctions de input_source.c   */
+void		open_script_input(t_data *data, char *path);
+void		init_input_source(t_data *data, int ac, char **av);
+char		*read_string_line(t_input *input);
+char		*read_input_line(t_data *data, char *prompt);
+void		exit_at_end_of_input(t_data *data);
+
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                 HISTORY                                   */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+/*   Fonctions de history.c   */
+t_history	*get_history(t_history *history);
+int			get_history_size(t_data *data);
+char		*get_history_path(t_data *data);
+void		init_history(t_data *data);
+void		record_history_line(t_data *data, char *line);
+
+/*   Fonctions de history_file.c   */
+void		append_history_line(t_history *history, char *line);
+void		remember_history_line(t_history *history, char *line);
+void		load_history_file(t_history *history);
+int			history_lazy_previous(int count, int key);
+int			history_lazy_search(int count, int key);
+
+/*   Fonctions de history_file_utils.c   */
+void		read_history_file_lines(t_history *history, t_reader *reader);
+
+/*   Fonctions de history_condition.c   */
+bool		is_blank_history_line(char *line);
+bool		is_duplicate_history_line(t_history *history, char *line);
+
+/*   Fonctions de input_stdin.c   */
+void		open_stdin_input(t_data *data);
+void		release_unread_input(t_data *data);
+void		reclaim_unread_input(t_data *data);
+void		drop_unread_input(t_data *data);
+
+/*   Fonctions de input_source_condition.c   */
+bool		is_interactive_input(t_data *data);
+bool		is_command_string_mode(int ac, char **av);
+bool		is_input_exhausted(t_data *data);
+bool		is_embedded_parent(t_data *data);
+
+/*   Fonctions de input_embedded.c   */
+void		reset_input_source(t_input *input);
+void		init_embedded_input(t_data *data);
+
+/*   Fonctions de input_readline.c   */
+void		ctrl_c_handler(int sig);
+void		init_readline_input(t_data *data);
+
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 /*                                  LEXER                                    */
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
@@ -817,6 +1541,15 @@ int			ft_write_fd(char *str, int fd);
 void		add_lexer_to_end(t_data *data, char *str);
 void		process_lexer_input(char *str, int *i, int *j, t_quote *state);
 
+/*   Fonctions de lexer_paren_expansion.c   */
+size_t		get_paren_expansion_length(const char *str);
+int			get_expansion_step(const char *str);
+int			get_quoted_expansion_step(const char *str, int is_single_quoted);
+bool		skip_paren_expansion(const char *str, int *i, int *j, \
+			t_quote *state);
+bool		copy_paren_expansion(const char *command, char *new_command, \
+			size_t *i, size_t *j);
+
 /*   Fonctions de lexer_utils.c   */
 int			check_redir_error(t_lexer *tmp);
 int			count_words_in_input(char *str);
@@ -831,6 +1564,7 @@ void		get_token_in_node(t_lexer **lexer_list, t_lexer *tmp);
 void		ft_init_lexer_process(t_data *data);
 void		process_input_string(\
 			t_data *data, t_lexer *tmp, t_lexer *current, int i);
+void		mark_quoted_heredoc_delimiters(t_data *data);
 
 /*   Fonctions divers de lexer   */
 int			is_white_space(char c);
@@ -864,6 +1598,7 @@ int			slash_check(char *str, char c);
 int			directory_check(char *str);
 int			pipe_bracket_check(char *str);
 int			err_code_directory(t_data *data);
+int			cmd_subst_check(char *str);
 
 /*   Fonctions de token_remover.c   */
 char		*remove_dbl_quotes(t_data *data, char *tmp);
@@ -877,7 +1612,6 @@ void		token_remover_2(t_data *data);
 /*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
 
 /*   Fonctions de signal_heredoc.c   */
-void		ctrl_c_handler(int sig);
 void		ctrl_c_handler_here_doc(int sig);
 void		handle_sig(t_data *data);
 
@@ -4,15 +4,39 @@
 # include <stdarg.h>
 # include <unistd.h>
 
+# define FT_DPRINTF_BUFFER_SIZE 4096
+# define FT_DPRINTF_NUMBER_SIZE 24
+
+typedef struct s_fmtbuf
+{
+	int		fd;
+	int		has_failed;
+	int		total;
+	int		len;
+	char	buffer[FT_DPRINTF_BUFFER_SIZE];
+}	t_fmtbuf;
+
+typedef struct s_fmtspec
+{
+	char	conversion;
+	char	pad;
+	int		width;
+	int		is_long;
+}	t_fmtspec;
+
 int		ft_printf(const char *text, ...);
-int		length_of_number_for_string_conversion(long n);
+int		ft_dprintf(int fd, const char *text, ...);
+int		ft_vdprintf(int fd, const char *text, va_list ap);
+void	fmt_flush(t_fmtbuf *buf);
+void	fmt_write(t_fmtbuf *buf, const char *str, int len);
+void	fmt_pad(t_fmtbuf *buf, char c, int count);
+void	fmt_init(t_fmtbuf *buf, int fd);
+int		fmt_finish(t_fmtbuf *buf);
+void	fmt_put_number(t_fmtbuf *buf, t_fmtspec *spec, unsigned long n, \
+		int is_neg);
+void	fmt_put_conversion(t_fmtbuf *buf, t_fmtspec *spec, va_list *ap);
 int		ft_putchar(char c);
 int		ft_putstr(char *str);
-int		ft_putnbr_base(int nbr, char *base);
-int		ft_putnbr_base_neg(unsigned int nbr, char *base);
-int		ft_pointeur(void *ptr, char *base);
-int		ft_putnbr_base_hex(unsigned int nbr, char *base);
-int		ft_len_nb_hexa(unsigned long n);
 void	*ft_memset(void *s, int c, size_t n);
 
 #endif
@@ -0,0 +1,49 @@
+#ifndef FT_READER_H
+# define FT_READER_H
+
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <stdlib.h>
+# include <unistd.h>
+# include <stdio.h>
+# include <string.h>
+
+# define FT_READER_SIZE 65536
+# define FT_READER_LINE 1
+# define FT_READER_EOF 0
+# define FT_READER_ERROR -1
+
+/*
+	Lecteur de lignes sur un fd : un tampon circulaire de FT_READER_SIZE
+	octets, un par fd, sans etat statique. Une ligne qui ne traverse pas
+	la fin du tampon est rendue sur place ; sinon elle est recopiee dans
+	spill. Le pointeur rendu reste valide jusqu'au prochain appel.
+*/
+typedef struct s_reader
+{
+	int		fd;
+	int		is_eof;
+	size_t	head;
+	size_t	len;
+	size_t	scanned;
+	char	*ring;
+	char	*spill;
+	size_t	spill_len;
+	size_t	spill_cap;
+}	t_reader;
+
+int		ft_reader_init(t_reader *reader, int fd);
+void	ft_reader_free(t_reader *reader);
+int		ft_reader_fill(t_reader *reader);
+int		ft_reader_next_line(t_reader *reader, char **line, size_t *len);
+int		ft_reader_find_newline(t_reader *reader, size_t *offset);
+void	ft_reader_consume(t_reader *reader, size_t count);
+int		ft_reader_cut_line(t_reader *reader, size_t offset, char **line, \
+		size_t *len);
+int		ft_reader_spill(t_reader *reader, const char *str, size_t len);
+int		ft_reader_spill_ring(t_reader *reader, size_t count);
+int		ft_reader_take_spill(t_reader *reader, char **line, size_t *len);
+int		ft_strlen(char *s);
+
+#endif
@@ -1,20 +0,0 @@
-#ifndef GET_NEXT_LINE_H
-# define GET_NEXT_LINE_H
-
-# include <sys/types.h>
-# include <sys/stat.h>
-# include <fcntl.h>
-# include <stdlib.h>
-# include <unistd.h>
-# include <stdio.h>
-
-# ifndef BUFFER_SIZE
-#  define BUFFER_SIZE 1
-# endif
-
-char	*get_next_line(int fd);
-int		ft_strrchr(char *s, int c);
-char	*ft_strjoin(char *s1, char *s2);
-int		ft_strlen(char *s);
-
-#endif
@@ -3,7 +3,7 @@
 
 # include <fcntl.h>
 # include "ft_printf.h"
-# include "get_next_line.h"
+# include "ft_reader.h"
 # include <stdlib.h>
 
 char		**ft_split(char const *s, char c);
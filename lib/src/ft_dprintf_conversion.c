@@ -0,0 +1,67 @@
+#include "../includes/ft_printf.h"
+
+static void	fmt_put_string(t_fmtbuf *buf, t_fmtspec *spec, const char *str)
+{
+	int	len;
+
+	if (!str)
+		str = "(null)";
+	len = 0;
+	while (str[len])
+		len++;
+	fmt_pad(buf, ' ', spec->width - len);
+	fmt_write(buf, str, len);
+}
+
+static void	fmt_put_signed(t_fmtbuf *buf, t_fmtspec *spec, long n)
+{
+	if (n < 0)
+		fmt_put_number(buf, spec, -(unsigned long)n, 1);
+	else
+		fmt_put_number(buf, spec, n, 0);
+}
+
+static void	fmt_put_pointer(t_fmtbuf *buf, t_fmtspec *spec, void *ptr)
+{
+	if (!ptr)
+	{
+		fmt_write(buf, "(nil)", 5);
+		return ;
+	}
+	fmt_write(buf, "0x", 2);
+	spec->width = 0;
+	fmt_put_number(buf, spec, (unsigned long)ptr, 0);
+}
+
+static void	fmt_put_unsigned(t_fmtbuf *buf, t_fmtspec *spec, va_list *ap)
+{
+	if (spec->is_long)
+		fmt_put_number(buf, spec, va_arg(*ap, unsigned long), 0);
+	else
+		fmt_put_number(buf, spec, va_arg(*ap, unsigned int), 0);
+}
+
+void	fmt_put_conversion(t_fmtbuf *buf, t_fmtspec *spec, va_list *ap)
+{
+	char	c;
+
+	if (spec->conversion == 'c')
+	{
+		c = va_arg(*ap, int);
+		fmt_write(buf, &c, 1);
+	}
+	else if (spec->conversion == 's')
+		fmt_put_string(buf, spec, va_arg(*ap, char *));
+	else if ((spec->conversion == 'd' || spec->conversion == 'i') \
+	&& spec->is_long)
+		fmt_put_signed(buf, spec, va_arg(*ap, long));
+	else if (spec->conversion == 'd' || spec->conversion == 'i')
+		fmt_put_signed(buf, spec, va_arg(*ap, int));
+	else if (spec->conversion == 'p')
+		fmt_put_pointer(buf, spec, va_arg(*ap, void *));
+	else if (spec->conversion == 'u' || spec->conversion == 'x' \
+	|| spec->conversion == 'X')
+		fmt_put_unsigned(buf, spec, ap);
+	else
+		fmt_write(buf, &spec->conversion, 1);
+}
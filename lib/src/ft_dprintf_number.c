@@ -0,0 +1,45 @@
+#include "../includes/ft_printf.h"
+
+/*
+	Ecrit 'n' a la fin de 'digits' dans la base de la conversion et
+	renvoie l'indice du premier chiffre.
+*/
+static int	fmt_number_to_digits(char *digits, unsigned long n, \
+		char conversion)
+{
+	const char	*base;
+	int			radix;
+	int			i;
+
+	base = "0123456789";
+	if (conversion == 'x' || conversion == 'p')
+		base = "0123456789abcdef";
+	if (conversion == 'X')
+		base = "0123456789ABCDEF";
+	radix = 10 + 6 * (base[10] != '\0');
+	i = FT_DPRINTF_NUMBER_SIZE;
+	digits[--i] = base[n % radix];
+	while (n / radix)
+	{
+		n /= radix;
+		digits[--i] = base[n % radix];
+	}
+	return (i);
+}
+
+void	fmt_put_number(t_fmtbuf *buf, t_fmtspec *spec, unsigned long n, \
+		int is_neg)
+{
+	char	digits[FT_DPRINTF_NUMBER_SIZE];
+	int		i;
+	int		len;
+
+	i = fmt_number_to_digits(digits, n, spec->conversion);
+	len = FT_DPRINTF_NUMBER_SIZE - i;
+	if (is_neg && spec->pad == '0')
+		fmt_write(buf, "-", 1);
+	fmt_pad(buf, spec->pad, spec->width - is_neg - len);
+	if (is_neg && spec->pad != '0')
+		fmt_write(buf, "-", 1);
+	fmt_write(buf, digits + i, len);
+}
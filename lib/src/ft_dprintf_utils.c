@@ -0,0 +1,55 @@
+#include "../includes/ft_printf.h"
+
+void	fmt_flush(t_fmtbuf *buf)
+{
+	ssize_t	written;
+	int		offset;
+
+	offset = 0;
+	while (!buf->has_failed && offset < buf->len)
+	{
+		written = write(buf->fd, buf->buffer + offset, buf->len - offset);
+		if (written < 0)
+			buf->has_failed = 1;
+		else
+			offset += written;
+	}
+	buf->len = 0;
+}
+
+void	fmt_write(t_fmtbuf *buf, const char *str, int len)
+{
+	buf->total += len;
+	while (len-- > 0)
+	{
+		if (buf->len == FT_DPRINTF_BUFFER_SIZE)
+			fmt_flush(buf);
+		buf->buffer[buf->len++] = *str++;
+	}
+}
+
+void	fmt_pad(t_fmtbuf *buf, char c, int count)
+{
+	while (count-- > 0)
+		fmt_write(buf, &c, 1);
+}
+
+void	fmt_init(t_fmtbuf *buf, int fd)
+{
+	buf->fd = fd;
+	buf->has_failed = 0;
+	buf->total = 0;
+	buf->len = 0;
+}
+
+/*
+	Vide le tampon ; renvoie le nombre d'octets formates, ou -1 si un
+	write a echoue.
+*/
+int	fmt_finish(t_fmtbuf *buf)
+{
+	fmt_flush(buf);
+	if (buf->has_failed)
+		return (-1);
+	return (buf->total);
+}
@@ -1,19 +0,0 @@
-#include "../includes/ft_printf.h"
-
-int	length_of_number_for_string_conversion(long n)
-{
-	int	i;
-
-	i = 0;
-	if (n == 0)
-	{
-		i = 1;
-		return (i);
-	}
-	while (n != 0)
-	{
-		i++;
-		n = n / 10;
-	}
-	return (i);
-}
@@ -1,59 +1,75 @@
 #include "../includes/ft_printf.h"
-#include <stdio.h>
-#include <limits.h>
 
-int	ft_ecrireformat(char c, va_list ptr)
+static const char	*ft_parse_spec(const char *text, t_fmtspec *spec)
 {
-	int	res;
-
-	res = 0;
-	if (c == 'c')
-		res = ft_putchar(va_arg(ptr, int));
-	if (c == 's')
-		res = ft_putstr(va_arg(ptr, char *));
-	if (c == 'd' || c == 'i')
-		res = ft_putnbr_base(va_arg(ptr, int), "0123456789");
-	if (c == 'u')
-		res = ft_putnbr_base_neg(va_arg(ptr, unsigned int), "0123456789");
-	if (c == 'x')
-		res = ft_putnbr_base_hex(va_arg(ptr, unsigned int), "0123456789abcdef");
-	if (c == 'X')
-		res = ft_putnbr_base_hex(va_arg(ptr, int), "0123456789ABCDEF");
-	if (c == '%')
-		res = ft_putchar('%');
-	if (c == 'p')
-		res = ft_pointeur(va_arg(ptr, void *), "0123456789abcdef");
-	return (res);
+	spec->pad = ' ';
+	spec->width = 0;
+	spec->is_long = 0;
+	if (*text == '0')
+	{
+		spec->pad = '0';
+		text++;
+	}
+	while (*text >= '0' && *text <= '9')
+		spec->width = spec->width * 10 + *text++ - '0';
+	while (*text == 'l' || *text == 'z')
+	{
+		spec->is_long = 1;
+		text++;
+	}
+	spec->conversion = *text;
+	return (text);
 }
 
-int	ft_printf(const char *text, ...)
+/*
+	Formate dans un tampon sur la pile et ne fait qu'un write par
+	FT_DPRINTF_BUFFER_SIZE octets au lieu d'un write par caractere.
+*/
+int	ft_vdprintf(int fd, const char *text, va_list ap)
 {
-	va_list	ptr;
-	int		res;
+	t_fmtbuf	buf;
+	t_fmtspec	spec;
+	va_list		args;
+	const char	*start;
 
-	res = 0;
-	va_start(ptr, text);
+	fmt_init(&buf, fd);
+	va_copy(args, ap);
 	while (*text)
 	{
-		if (*text == '%')
-		{
+		start = text;
+		while (*text && *text != '%')
 			text++;
-			res = res + ft_ecrireformat(*text, ptr);
+		fmt_write(&buf, start, text - start);
+		if (*text == '%' && *(text + 1))
+		{
+			text = ft_parse_spec(text + 1, &spec);
+			fmt_put_conversion(&buf, &spec, &args);
 		}
-		else
-			res = res + ft_putchar(*text);
-		text++;
+		if (*text)
+			text++;
 	}
-	va_end(ptr);
+	va_end(args);
+	return (fmt_finish(&buf));
+}
+
+int	ft_dprintf(int fd, const char *text, ...)
+{
+	va_list	ap;
+	int		res;
+
+	va_start(ap, text);
+	res = ft_vdprintf(fd, text, ap);
+	va_end(ap);
 	return (res);
 }
 
-// int	main(void)
-// {
-// 	int res;
-// 	char *s = NULL;
-// 	ft_printf("%p, %p\n", ULONG_MAX, -ULONG_MAX);
-// 	printf("%p, %p", ULONG_MAX, -ULONG_MAX);
-// 	// printf("\n%d\n", res);
-// 	// printf("nombres de caracteres : %d\n", res);
-// }
+int	ft_printf(const char *text, ...)
+{
+	va_list	ap;
+	int		res;
+
+	va_start(ap, text);
+	res = ft_vdprintf(STDERR_FILENO, text, ap);
+	va_end(ap);
+	return (res);
+}
@@ -5,19 +5,10 @@ int	ft_putstr(char *str)
 {
 	int	i;
 
-	i = 0;
 	if (!str)
-	{
-		i = write(1, "(null)", 6);
-		return (i);
-	}
-	else
-	{
-		while (str[i] != '\0')
-		{
-			ft_putchar(str[i]);
-			i++;
-		}
-	}
-	return (i);
+		return (write(2, "(null)", 6));
+	i = 0;
+	while (str[i] != '\0')
+		i++;
+	return (write(2, str, i));
 }
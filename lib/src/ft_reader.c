@@ -0,0 +1,92 @@
+#include "../includes/ft_reader.h"
+#include <errno.h>
+
+int	ft_reader_init(t_reader *reader, int fd)
+{
+	reader->fd = fd;
+	reader->is_eof = 0;
+	reader->head = 0;
+	reader->len = 0;
+	reader->scanned = 0;
+	reader->spill = NULL;
+	reader->spill_len = 0;
+	reader->spill_cap = 0;
+	reader->ring = malloc(FT_READER_SIZE);
+	if (!reader->ring)
+		return (FT_READER_ERROR);
+	return (0);
+}
+
+void	ft_reader_free(t_reader *reader)
+{
+	free(reader->ring);
+	free(reader->spill);
+	reader->ring = NULL;
+	reader->spill = NULL;
+	reader->len = 0;
+	reader->spill_len = 0;
+	reader->spill_cap = 0;
+}
+
+/*
+	Un seul read dans la plus grande zone libre contigue du tampon.
+	Renvoie le nombre d'octets lus, 0 a EOF, -1 sur erreur.
+*/
+int	ft_reader_fill(t_reader *reader)
+{
+	size_t	tail;
+	size_t	room;
+	ssize_t	got;
+
+	if (reader->len == 0)
+		reader->head = 0;
+	tail = (reader->head + reader->len) % FT_READER_SIZE;
+	room = FT_READER_SIZE - tail;
+	if (tail < reader->head || reader->len == FT_READER_SIZE)
+		room = reader->head - tail;
+	got = read(reader->fd, reader->ring + tail, room);
+	while (got < 0 && errno == EINTR)
+		got = read(reader->fd, reader->ring + tail, room);
+	if (got < 0)
+		return (FT_READER_ERROR);
+	if (got == 0)
+		reader->is_eof = 1;
+	reader->len += got;
+	return (got);
+}
+
+static int	ft_reader_finish(t_reader *reader, char **line, size_t *len)
+{
+	if (reader->len && ft_reader_spill_ring(reader, reader->len) < 0)
+		return (FT_READER_ERROR);
+	if (!reader->spill_len)
+		return (FT_READER_EOF);
+	return (ft_reader_take_spill(reader, line, len));
+}
+
+/*
+	Rend la ligne suivante sans son '\n', terminee par '\0'. Une ligne plus
+	longue que le tampon s'accumule dans spill au fur et a mesure.
+	Renvoie FT_READER_LINE, FT_READER_EOF ou FT_READER_ERROR.
+*/
+int	ft_reader_next_line(t_reader *reader, char **line, size_t *len)
+{
+	size_t	offset;
+	int		got;
+
+	while (1)
+	{
+		if (ft_reader_find_newline(reader, &offset))
+			return (ft_reader_cut_line(reader, offset, line, len));
+		if (reader->len == FT_READER_SIZE \
+			&& ft_reader_spill_ring(reader, reader->len) < 0)
+			return (FT_READER_ERROR);
+		got = 0;
+		if (!reader->is_eof)
+			got = ft_reader_fill(reader);
+		if (got < 0)
+			return (FT_READER_ERROR);
+		if (got == 0)
+			return (ft_reader_finish(reader, line, len));
+	}
+}
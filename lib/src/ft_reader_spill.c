@@ -0,0 +1,52 @@
+#include "../includes/ft_reader.h"
+
+int	ft_reader_spill(t_reader *reader, const char *str, size_t len)
+{
+	char	*grown;
+	size_t	cap;
+
+	if (reader->spill_len + len + 1 > reader->spill_cap)
+	{
+		cap = reader->spill_cap * 2;
+		if (cap < reader->spill_len + len + 1)
+			cap = reader->spill_len + len + 1;
+		grown = malloc(cap);
+		if (!grown)
+			return (FT_READER_ERROR);
+		if (reader->spill)
+			memcpy(grown, reader->spill, reader->spill_len);
+		free(reader->spill);
+		reader->spill = grown;
+		reader->spill_cap = cap;
+	}
+	memcpy(reader->spill + reader->spill_len, str, len);
+	reader->spill_len += len;
+	reader->spill[reader->spill_len] = '\0';
+	return (0);
+}
+
+/*
+	Recopie les count premiers octets du tampon (un ou deux morceaux)
+	a la suite de spill et les retire du tampon.
+*/
+int	ft_reader_spill_ring(t_reader *reader, size_t count)
+{
+	size_t	first;
+
+	first = count;
+	if (first > FT_READER_SIZE - reader->head)
+		first = FT_READER_SIZE - reader->head;
+	if (ft_reader_spill(reader, reader->ring + reader->head, first) < 0 \
+		|| ft_reader_spill(reader, reader->ring, count - first) < 0)
+		return (FT_READER_ERROR);
+	ft_reader_consume(reader, count);
+	return (0);
+}
+
+int	ft_reader_take_spill(t_reader *reader, char **line, size_t *len)
+{
+	*line = reader->spill;
+	*len = reader->spill_len;
+	reader->spill_len = 0;
+	return (FT_READER_LINE);
+}
@@ -0,0 +1,58 @@
+#include "../includes/ft_reader.h"
+
+/*
+	Cherche le prochain '\n' avec memchr sur les deux morceaux contigus du
+	tampon, en reprenant apres ce qui a deja ete parcouru.
+*/
+int	ft_reader_find_newline(t_reader *reader, size_t *offset)
+{
+	size_t	pos;
+	size_t	chunk;
+	char	*hit;
+
+	while (reader->scanned < reader->len)
+	{
+		pos = (reader->head + reader->scanned) % FT_READER_SIZE;
+		chunk = reader->len - reader->scanned;
+		if (chunk > FT_READER_SIZE - pos)
+			chunk = FT_READER_SIZE - pos;
+		hit = memchr(reader->ring + pos, '\n', chunk);
+		if (hit)
+		{
+			*offset = reader->scanned + (hit - (reader->ring + pos));
+			return (1);
+		}
+		reader->scanned += chunk;
+	}
+	return (0);
+}
+
+void	ft_reader_consume(t_reader *reader, size_t count)
+{
+	reader->head = (reader->head + count) % FT_READER_SIZE;
+	reader->len -= count;
+	reader->scanned = 0;
+	if (reader->len == 0)
+		reader->head = 0;
+}
+
+/*
+	Si la ligne est d'un seul tenant dans le tampon, son '\n' devient '\0'
+	et elle est rendue sur place ; sinon elle finit dans spill.
+*/
+int	ft_reader_cut_line(t_reader *reader, size_t offset, char **line, \
+		size_t *len)
+{
+	if (!reader->spill_len && reader->head + offset < FT_READER_SIZE)
+	{
+		*line = reader->ring + reader->head;
+		*len = offset;
+		reader->ring[reader->head + offset] = '\0';
+		ft_reader_consume(reader, offset + 1);
+		return (FT_READER_LINE);
+	}
+	if (ft_reader_spill_ring(reader, offset) < 0)
+		return (FT_READER_ERROR);
+	ft_reader_consume(reader, 1);
+	return (ft_reader_take_spill(reader, line, len));
+}
@@ -1,53 +0,0 @@
-#include "../includes/get_next_line.h"
-#include <stdio.h>
-
-int	ft_strlen(char *s)
-{
-	int	i;
-
-	i = 0;
-	if (!s)
-		return (0);
-	while (s[i])
-		i++;
-	return (i);
-}
-
-int	ft_strrchr(char *s, int c)
-{
-	int	len;
-
-	len = ft_strlen(s);
-	while (len >= 0)
-	{
-		if (s[len] == (char)c)
-			return (1);
-		else
-			len--;
-	}
-	return (0);
-}
-
-char	*ft_strjoin(char *s1, char *s2)
-{
-	char	*s3;
-	int		i;
-	int		j;
-
-	i = -1;
-	j = -1;
-	if (!s1 && !s2)
-		return (NULL);
-	s3 = malloc(sizeof(char) * (ft_strlen(s1) + ft_strlen(s2) + 1));
-	if (!s3)
-		return (NULL);
-	while (s1 && s1[++j])
-		s3[++i] = s1[j];
-	j = -1;
-	while (s2 && s2[++j])
-		s3[++i] = s2[j];
-	s3[++i] = '\0';
-	if (s1)
-		free(s1);
-	return (s3);
-}
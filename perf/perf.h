@@ -0,0 +1,42 @@
+#ifndef PERF_H
+# define PERF_H
+
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+/*                                  PERF                                     */
+/*   -'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-'-,-',-'   */
+
+# include "../include/minishell.h"
+# include "../include/libminishell.h"
+
+/*   PERF CONSTANTS   */
+# define PERF_NAME_SIZE 64
+# define PERF_PATH_SIZE 1024
+# define PERF_CORPUS_EXT ".msh"
+# define NSEC_PER_MSEC 1000000L
+
+typedef struct s_perf_case
+{
+	char			name[PERF_NAME_SIZE];
+	long			max_ms;
+	unsigned long	max_allocs;
+	unsigned long	max_syscalls;
+	long			ns;
+	unsigned long	allocs;
+	unsigned long	syscalls;
+	int				exit_status;
+}	t_perf_case;
+
+/*   Fonctions de perf_utils.c   */
+char	*read_corpus_file(const char *path, size_t *len);
+int		silence_output(int *saved);
+void	restore_output(int *saved);
+void	measure_stat_delta(t_perf_case *perf, unsigned long *before);
+bool	parse_budget_line(char *line, t_perf_case *perf);
+
+/*   Fonctions de perf_check.c   */
+bool	measure_case(t_perf_case *perf, char *script, size_t len);
+bool	run_case(t_perf_case *perf, const char *corpus_dir);
+bool	report_case(t_perf_case *perf);
+int		run_budgets(char *budgets, const char *corpus_dir);
+
+#endif
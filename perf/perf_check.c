@@ -0,0 +1,121 @@
+#include "perf.h"
+
+/*
+	Rejoue le script dans le coeur du shell (libminishell) avec un
+	environnement fixe, pour que les compteurs ne dependent pas de celui
+	de l'appelant.
+*/
+bool	measure_case(t_perf_case *perf, char *script, size_t len)
+{
+	static char		*env[4];
+	unsigned long	before[STAT_NB];
+	struct timespec	times[2];
+	int				saved[2];
+
+	env[0] = "PATH=/usr/bin:/bin";
+	env[1] = "HOME=/perf/home";
+	env[2] = "PERF_H=heredoc";
+	if (ms_init(env) == FAIL || silence_output(saved) == FAIL)
+		return (FALSE);
+	memcpy(before, get_shell_stats(NULL)->total, sizeof(before));
+	clock_gettime(CLOCK_MONOTONIC, &times[0]);
+	perf->exit_status = ms_run_line(script, len);
+	clock_gettime(CLOCK_MONOTONIC, &times[1]);
+	restore_output(saved);
+	perf->ns = elapsed_trace_ns(&times[0], &times[1]);
+	measure_stat_delta(perf, before);
+	ms_free();
+	return (TRUE);
+}
+
+bool	run_case(t_perf_case *perf, const char *corpus_dir)
+{
+	char	path[PERF_PATH_SIZE];
+	char	*script;
+	size_t	len;
+	bool	is_measured;
+
+	snprintf(path, sizeof(path), "%s/%s%s", corpus_dir, perf->name, \
+	PERF_CORPUS_EXT);
+	script = read_corpus_file(path, &len);
+	if (!script)
+	{
+		ft_dprintf(STDERR_FILENO, "perf-check: %s: %s\n", path, \
+		strerror(errno));
+		return (FALSE);
+	}
+	is_measured = measure_case(perf, script, len);
+	free(script);
+	return (is_measured);
+}
+
+/*
+	Une ligne JSON par cas avec la mesure et le budget ; le cas echoue
+	des qu'une des trois mesures depasse son budget, ou si sa derniere
+	commande echoue : un cas peut ainsi finir par verifier un resultat
+	avec test.
+*/
+bool	report_case(t_perf_case *perf)
+{
+	bool	is_within_budget;
+	char	*status;
+
+	is_within_budget = perf->ns <= perf->max_ms * NSEC_PER_MSEC \
+	&& perf->allocs <= perf->max_allocs \
+	&& perf->syscalls <= perf->max_syscalls && !perf->exit_status;
+	status = "FAIL";
+	if (is_within_budget)
+		status = "ok";
+	printf("{\"case\":\"%s\",\"ms\":%.1f,\"max_ms\":%ld,\"allocs\":%lu,"
+		"\"max_allocs\":%lu,\"syscalls\":%lu,\"max_syscalls\":%lu,"
+		"\"exit\":%d,\"status\":\"%s\"}\n", perf->name,
+		(double)perf->ns / NSEC_PER_MSEC, perf->max_ms, perf->allocs,
+		perf->max_allocs, perf->syscalls, perf->max_syscalls,
+		perf->exit_status, status);
+	fflush(stdout);
+	return (is_within_budget);
+}
+
+int	run_budgets(char *budgets, const char *corpus_dir)
+{
+	t_perf_case	perf;
+	char		*line;
+	int			status;
+
+	status = EXIT_SUCCESS;
+	line = strtok(budgets, "\n");
+	while (line)
+	{
+		if (parse_budget_line(line, &perf) \
+		&& (!run_case(&perf, corpus_dir) || !report_case(&perf)))
+			status = EXIT_FAILURE;
+		line = strtok(NULL, "\n");
+	}
+	return (status);
+}
+
+/*
+	./minishell_perf BUDGETS CORPUS_DIR : rejoue chaque cas du fichier de
+	budgets et sort avec 1 si l'un d'eux a regresse.
+*/
+int	main(int ac, char **av)
+{
+	char	*budgets;
+	size_t	len;
+	int		status;
+
+	if (ac != 3)
+	{
+		ft_dprintf(STDERR_FILENO, "usage: minishell_perf BUDGETS CORPUS\n");
+		return (2);
+	}
+	budgets = read_corpus_file(av[1], &len);
+	if (!budgets)
+	{
+		perror(av[1]);
+		return (2);
+	}
+	status = run_budgets(budgets, av[2]);
+	free(budgets);
+	return (status);
+}
@@ -0,0 +1,88 @@
+#include "perf.h"
+
+char	*read_corpus_file(const char *path, size_t *len)
+{
+	struct stat	st;
+	char		*buf;
+	ssize_t		nread;
+	int			fd;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0 || fstat(fd, &st) < 0)
+		return (NULL);
+	buf = malloc(st.st_size + 1);
+	*len = ZERO_INIT;
+	while (buf && *len < (size_t)st.st_size)
+	{
+		nread = read(fd, buf + *len, st.st_size - *len);
+		if (nread <= 0)
+			break ;
+		*len += nread;
+	}
+	close(fd);
+	if (buf)
+		buf[*len] = '\0';
+	return (buf);
+}
+
+/*
+	La sortie des commandes du corpus part dans /dev/null : seul le
+	rapport du harnais doit apparaitre.
+*/
+int	silence_output(int *saved)
+{
+	int	devnull;
+
+	devnull = open("/dev/null", O_WRONLY | O_CLOEXEC);
+	if (devnull < 0)
+		return (FAIL);
+	saved[0] = dup(STDOUT_FILENO);
+	saved[1] = dup(STDERR_FILENO);
+	dup2(devnull, STDOUT_FILENO);
+	dup2(devnull, STDERR_FILENO);
+	close(devnull);
+	return (ZERO_INIT);
+}
+
+void	restore_output(int *saved)
+{
+	dup2(saved[0], STDOUT_FILENO);
+	dup2(saved[1], STDERR_FILENO);
+	close(saved[0]);
+	close(saved[1]);
+}
+
+/*
+	Difference des compteurs de shellstat (enfants compris) : les
+	malloc_track d'un cote, tous les appels systeme comptes de l'autre.
+*/
+void	measure_stat_delta(t_perf_case *perf, unsigned long *before)
+{
+	t_shellstat	*stats;
+	int			id;
+
+	stats = get_shell_stats(NULL);
+	perf->allocs = ZERO_INIT;
+	perf->syscalls = ZERO_INIT;
+	id = ZERO_INIT;
+	while (stats && id < STAT_NB)
+	{
+		if (id == STAT_ALLOC)
+			perf->allocs = stats->total[id] - before[id];
+		else
+			perf->syscalls += stats->total[id] - before[id];
+		id++;
+	}
+}
+
+/*
+	"nom max_ms max_allocs max_syscalls" ; les lignes vides et les
+	commentaires (#) sont ignores.
+*/
+bool	parse_budget_line(char *line, t_perf_case *perf)
+{
+	if (line[0] == '#')
+		return (FALSE);
+	return (sscanf(line, "%63s %ld %lu %lu", perf->name, &perf->max_ms, \
+	&perf->max_allocs, &perf->max_syscalls) == 4);
+}
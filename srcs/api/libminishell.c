@@ -0,0 +1,78 @@
+#include "../../include/minishell.h"
+#include "../../include/libminishell.h"
+
+int	ms_init(char **envp)
+{
+	t_data		*data;
+	static char	*av[2];
+
+	if (*get_embedded_shell())
+		return (FAIL);
+	data = malloc(sizeof(t_data));
+	if (!data)
+		return (FAIL);
+	av[0] = "minishell";
+	init_data(data, 1, av, envp);
+	init_embedded_input(data);
+	data->utils = init_env(data, envp);
+	if (!data->utils)
+	{
+		ft_free_all(data);
+		free(data);
+		return (FAIL);
+	}
+	data->utils->head_of_linked_list_env_var = NULL;
+	g_globi = ZERO_INIT;
+	*get_embedded_shell() = data;
+	return (ZERO_INIT);
+}
+
+/*
+	La chaine est copiee : line n'a pas besoin d'etre terminee par '\0'.
+	Les signaux de l'hote sont remis en place avant de rendre la main.
+	Tout ce que les lignes ont alloue est libere en sortant, sauf ce qui
+	est passe a l'environnement (env_memory) : la memoire de l'hote ne
+	grandit pas d'un appel a l'autre.
+*/
+int	ms_run_line(const char *line, size_t len)
+{
+	t_data				*data;
+	struct sigaction	saved[2];
+	t_trash_memory		*mark;
+
+	data = *get_embedded_shell();
+	if (!data)
+		return (FAIL);
+	if (data->input.is_closed)
+		return (g_globi);
+	data->input.str = strndup(line, len);
+	if (!data->input.str)
+		return (FAIL);
+	data->input.str_pos = ZERO_INIT;
+	mark = data->trash_memory;
+	save_host_signals(saved);
+	run_embedded_lines(data);
+	restore_host_signals(saved);
+	release_trash_until(data, mark);
+	data->lexer_list = NULL;
+	free(data->input.str);
+	data->input.str = NULL;
+	return (g_globi);
+}
+
+int	ms_last_status(void)
+{
+	return (g_globi);
+}
+
+void	ms_free(void)
+{
+	t_data	*data;
+
+	data = *get_embedded_shell();
+	if (!data)
+		return ;
+	ft_free_all(data);
+	free(data);
+	*get_embedded_shell() = NULL;
+}
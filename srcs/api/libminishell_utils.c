@@ -0,0 +1,42 @@
+#include "../../include/minishell.h"
+
+/*
+	Un seul shell embarque par processus, comme il n'y a qu'un g_globi :
+	son adresse est gardee ici entre deux appels de l'API.
+*/
+t_data	**get_embedded_shell(void)
+{
+	static t_data	*shell;
+
+	return (&shell);
+}
+
+/*
+	Execute les lignes de la chaine une par une ; un here_doc lit son corps
+	dans les lignes suivantes, comme avec "minishell -c".
+*/
+void	run_embedded_lines(t_data *data)
+{
+	char	*line;
+
+	while (!data->input.is_closed)
+	{
+		line = read_input_line(data, NULL);
+		if (!line)
+			break ;
+		prompt_loop(line, data, NULL);
+		free(line);
+	}
+}
+
+void	save_host_signals(struct sigaction *saved)
+{
+	sigaction(SIGINT, NULL, &saved[0]);
+	sigaction(SIGQUIT, NULL, &saved[1]);
+}
+
+void	restore_host_signals(struct sigaction *saved)
+{
+	sigaction(SIGINT, &saved[0], NULL);
+	sigaction(SIGQUIT, &saved[1], NULL);
+}
@@ -78,5 +78,5 @@ void	exit_all(t_data *data)
 {
 	ft_write_fd("exit\n", STDOUT_FILENO);
 	ft_free_all(data);
-	exit(0);
+	exit_shell_process(data, 0);
 }
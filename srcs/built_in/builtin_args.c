@@ -0,0 +1,53 @@
+#include "../../include/minishell.h"
+
+int	count_builtin_args(t_lexer *lexer_lst)
+{
+	int	count;
+
+	count = 1;
+	lexer_lst = lexer_lst->next;
+	while (lexer_lst && lexer_lst->token != PIPE)
+	{
+		if (lexer_lst->token == ARG)
+			count++;
+		lexer_lst = lexer_lst->next;
+	}
+	return (count);
+}
+
+/*
+	Tableau argv du builtin (nom compris) : les ARG de son segment, sans
+	les redirections ni leurs cibles, termine par NULL.
+*/
+char	**collect_builtin_args(t_lexer *lexer_lst, t_data *data, int *argc)
+{
+	char	**argv;
+	int		i;
+
+	*argc = count_builtin_args(lexer_lst);
+	argv = malloc_track(data, sizeof(char *) * (*argc + 1));
+	if (!argv)
+		return (NULL);
+	i = ZERO_INIT;
+	argv[i++] = lexer_lst->cmd_segment;
+	lexer_lst = lexer_lst->next;
+	while (lexer_lst && lexer_lst->token != PIPE)
+	{
+		if (lexer_lst->token == ARG)
+			argv[i++] = lexer_lst->cmd_segment;
+		lexer_lst = lexer_lst->next;
+	}
+	argv[i] = NULL;
+	return (argv);
+}
+
+/*
+	Entree du builtin : la redirection du noeud si le builtin tourne dans
+	le shell sans qu'elle ait ete branchee sur stdin, sinon stdin.
+*/
+int	get_builtin_input_fd(t_data *data)
+{
+	if (data->utils->node && data->utils->node->input_fd >= 0)
+		return (data->utils->node->input_fd);
+	return (STDIN_FILENO);
+}
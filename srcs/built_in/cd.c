@@ -1,98 +1,53 @@
 #include "../../include/minishell.h"
 
 /*
-	verifi pwd dans la liste des variable d'env, et la met a jour
+	renvoie le premier argument de cd dans son segment de commande, NULL
+	si cd est appele sans argument
 */
-int	verif_pwd(char *str, t_data *data)
+t_lexer	*find_cd_operand(t_lexer *lexer_lst)
 {
-	t_env	*tmp;
-	char	*s1;
-
-	tmp = data->utils->linked_list_full_env_var_copy_alpha;
-	if (str == NULL)
-		return (0);
-	while (tmp)
-	{
-		if (ft_strncmp(\
-		tmp->var_env_name_and_value, ENV_SET_CURRENT_WORKING_DIR, \
-		ft_str_len_until_equal(ENV_SET_CURRENT_WORKING_DIR)) == 0)
-		{
-			s1 = ft_strjoin_free_arg2_with_memory_tracking(\
-			ENV_SET_CURRENT_WORKING_DIR, str, data);
-			tmp->var_env_name_and_value = create_new_var(s1, data);
-			return (1);
-		}
-		tmp = tmp->next_var_env_name_and_value;
-	}
-	return (0);
-}
-
-/*
-	cherche HOME dans les variable d'env et la retourne si elle est trouver
-	ou NULL sinon
-*/
-char	*get_home(t_env	*tmp, t_data *data)
-{
-	tmp = data->utils->linked_list_full_env_var_copy_alpha;
-	while (tmp)
-	{
-		if (!strncmp(ENV_SET_USER_HOME_DIR, tmp->var_env_name_and_value, 5))
-			return (tmp->var_env_name_and_value);
-		tmp = tmp->next_var_env_name_and_value;
-	}
+	lexer_lst = lexer_lst->next;
+	while (lexer_lst && lexer_lst->token != PIPE && lexer_lst->token != ARG)
+		lexer_lst = lexer_lst->next;
+	if (lexer_lst && lexer_lst->token == ARG)
+		return (lexer_lst);
 	return (NULL);
 }
 
-/*
-	pareil pour OLDPWD
-*/
-char	*get_old_pwd(t_env	*tmp, t_data *data)
+// check si il y a trop d'argument et gere l'erreur si c'est le cas
+int	wrong_cd(t_lexer *lexer_lst)
 {
-	tmp = data->utils->linked_list_full_env_var_copy_alpha;
-	while (tmp)
+	if (find_cd_operand(lexer_lst))
 	{
-		if (!strncmp(ENV_SET_OLDPWD, tmp->var_env_name_and_value, 6))
-			return (tmp->var_env_name_and_value);
-		tmp = tmp->next_var_env_name_and_value;
+		ft_dprintf(STDERR_FILENO, ERR_CD_TOO_MANY_ARGS);
+		g_globi = 1;
+		return (0);
 	}
-	return (NULL);
+	return (1);
 }
 
 /*
-	verifi HOME est la met a jour
+	sans argument cd va dans HOME, sinon dans le repertoire donne ; PWD et
+	OLDPWD sont mis a jour par change_directory
 */
-int	verif_home(char *str, t_data *data)
+void	get_cd(t_lexer *lexer_lst, t_data *data)
 {
-	t_env	*tmp;
-	char	*s1;
+	t_lexer	*operand;
+	char	*target;
 
-	tmp = data->utils->linked_list_full_env_var_copy_alpha;
-	while (tmp)
+	operand = find_cd_operand(lexer_lst);
+	if (operand && !wrong_cd(operand))
+		return ;
+	if (operand)
+		target = operand->cmd_segment;
+	else
+		target = find_env_hot_value(data, ENV_HOT_HOME);
+	if (!target)
 	{
-		if (ft_strncmp(\
-		tmp->var_env_name_and_value, ENV_SET_USER_HOME_DIR, \
-		ft_str_len_until_equal(ENV_SET_USER_HOME_DIR)) == 0)
-		{
-			s1 = ft_strjoin_free_arg2_with_memory_tracking(\
-			ENV_SET_USER_HOME_DIR, str, data);
-			tmp->var_env_name_and_value = create_new_var(s1, data);
-			return (1);
-		}
-		tmp = tmp->next_var_env_name_and_value;
-	}
-	return (0);
-}
-
-/*
-	change le repertoire courant par homme et gere les erreur chdir
-*/
-int	change_directory_for_home(t_env *tmp, t_data *data)
-{
-	if (chdir(get_home(tmp, data) + 5) == -1)
-	{
-		perror(CMD_CHANGE_DIRECTORY);
+		ft_dprintf(STDERR_FILENO, ERR_CD_HOME_NOT_SET);
 		g_globi = 1;
-		return (0);
+		return ;
 	}
-	return (1);
+	if (change_directory(data, target))
+		g_globi = 0;
 }
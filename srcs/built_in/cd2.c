@@ -1,127 +1,50 @@
 #include "../../include/minishell.h"
 
 /*
-change le repertoire courant par celui indiquer par pwd toujours avec chdir
-et ca gestion d'err
+	le repertoire logique courant devient OLDPWD et path le remplace, dans
+	le shell et dans PWD
 */
-int	change_directory_for_pwd(t_env *tmp, t_data *data)
+void	update_working_directory(t_data *data, char *path)
 {
-	printf("get_pwd_env(tmp) + 4) %s\n", get_pwd_env(tmp, data) + 4);
-	if (chdir(get_pwd_env(tmp, data) + 4) == -1)
-	{
-		perror(CMD_CHANGE_DIRECTORY);
-		g_globi = 1;
-		return (0);
-	}
-	return (1);
+	if (data->utils->logical_pwd.buffer)
+		set_env_hot_value(\
+		data, ENV_HOT_OLDPWD, data->utils->logical_pwd.buffer);
+	if (set_logical_pwd(data, data->utils, path))
+		set_env_hot_value(data, ENV_HOT_PWD, data->utils->logical_pwd.buffer);
 }
 
-/*
-	check si la chaine contient un = et si oui reconstruit la variable avec la
-	nouvelle variable et renvoie la chaine mise a jour
-*/
-char	*create_new_var(char *str, t_data *data)
+void	record_physical_directory(t_data *data)
 {
-	int		i;
-	int		flag;
-	char	*tmp;
+	char	*cwd;
 
-	flag = 0;
-	tmp = NULL;
-	i = ZERO_INIT;
-	while (str[i])
-	{
-		if (str[i] == '=')
-		{
-			flag++;
-			break ;
-		}
-		i++;
-	}
-	if (flag)
-	{
-		tmp = ft_substr(\
-		data, str, (unsigned int)i + 1, (size_t)ft_strlen(str));
-		str = ft_substr(data, str, 0, (size_t)i + 1);
-		str = ft_strjoin_with_memory_tracking(str, tmp, data);
-	}
-	return (str);
+	cwd = getcwd(NULL, 0);
+	if (!cwd)
+		return ;
+	update_working_directory(data, cwd);
+	free(cwd);
 }
 
 /*
-	verifie si cd n'a pas d'argument, et dans ce cas la change vers le HOME
-	si il y a des argument on appel cd_with_arg
+	change de repertoire en suivant le chemin logique (les .. retirent le
+	dernier composant, comme cd -L de bash) ; si ce chemin n'existe pas on
+	retente avec dir tel quel et on relit alors le chemin physique
 */
-void	get_cd(t_lexer *lexer_lst, t_data *data)
+int	change_directory(t_data *data, char *dir)
 {
-	t_env	*env;
-	int		i;
-	char	*path;
-	char	*old;
+	char	*logical;
 
-	i = ZERO_INIT;
-	path = NULL;
-	old = NULL;
-	env = data->utils->linked_list_full_env_var_copy_alpha;
-	if (lexer_lst)
+	logical = build_logical_path(data, dir);
+	if (logical && chdir(logical) != -1)
 	{
-		if ((ft_strcmp(lexer_lst->cmd_segment, CMD_CHANG_DIRCT) == 0)
-			&& lexer_lst->next == NULL)
-		{
-			if (change_directory_for_home(env, data))
-			{
-				path = getcwd(path, i);
-				verif_home(path, data);
-			}
-			return ;
-		}
-		if (cd_with_arg(data, path, old, &i) == 0)
-			return ;
+		update_working_directory(data, logical);
+		return (1);
 	}
-	lexer_lst = data->utils->head_lexer_lst;
-}
-
-// check si il y a trop d'argument et gere l'erreur si c'est le cas
-int	wrong_cd(t_lexer *lexer_lst)
-{
-	if (lexer_lst->next)
+	if (chdir(dir) == -1)
 	{
-		write (STDERR_FILENO, "minishell: cd: trop d'arguments\n", 27);
+		perror(CMD_CHANGE_DIRECTORY);
 		g_globi = 1;
 		return (0);
 	}
-	return (1);
-}
-
-/*
-	traite cd avec des arguments, recupere le repertoire courant et le stock
-	dans le OLDPWD et si les arguments sont valid, change le repertoire et met
-	a jour PWD
-*/
-int	cd_with_arg(t_data *data, char *path, char *old, int *i)
-{
-	if (((ft_strcmp(data->lexer_list->cmd_segment, CMD_CHANG_DIRCT) == 0)
-			&& data->lexer_list->next->cmd_segment))
-	{
-		if (data->lexer_list->next)
-			data->lexer_list = data->lexer_list->next;
-		old = getcwd(old, *i);
-		if (!old)
-		{
-			find_old_pwd(\
-			data->utils->linked_list_full_env_var_copy_alpha, data);
-			return (0);
-		}
-		else
-			verif_oldpwd(old, data);
-		if (!wrong_cd(data->lexer_list))
-			return (0);
-		if (change_directory(data->lexer_list->cmd_segment))
-		{
-			path = getcwd(path, *i);
-			verif_pwd(path, data);
-			g_globi = 0;
-		}
-	}
+	record_physical_directory(data);
 	return (1);
 }
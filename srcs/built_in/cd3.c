@@ -1,65 +1,114 @@
 #include "../../include/minishell.h"
 
-// change le repertoire courant vers le dir
-int	change_directory(char *dir)
+/*
+	ajoute les composants de src a path en retirant les '.', les '/' en
+	trop et, pour '..', le dernier composant deja ecrit
+*/
+void	append_path_components(char *path, size_t *len, const char *src)
 {
-	if (chdir(dir) == -1)
+	size_t	comp_len;
+
+	while (*src)
 	{
-		perror(CMD_CHANGE_DIRECTORY);
-		g_globi = 1;
-		return (0);
+		while (*src == '/')
+			src++;
+		comp_len = ZERO_INIT;
+		while (src[comp_len] && src[comp_len] != '/')
+			comp_len++;
+		if (comp_len == 2 && src[0] == '.' && src[1] == '.')
+		{
+			while (*len > 0 && path[*len - 1] != '/')
+				(*len)--;
+			if (*len > 0)
+				(*len)--;
+		}
+		else if (comp_len && !(comp_len == 1 && src[0] == '.'))
+		{
+			path[(*len)++] = '/';
+			memcpy(path + *len, src, comp_len);
+			*len += comp_len;
+		}
+		src += comp_len;
 	}
-	return (1);
+	path[*len] = '\0';
 }
 
-// change le repertoire courant vers celui indiquer par OLDPWD
-int	change_directory_for_oldpwd(t_env *tmp, t_data *data)
+/*
+	chemin absolu et canonique vise par cd dir, construit sur le
+	repertoire logique courant ; NULL si dir est relatif et que le shell
+	ne connait pas son repertoire courant
+*/
+char	*build_logical_path(t_data *data, const char *dir)
 {
-	if (chdir(get_old_pwd(tmp, data) + 7) == -1)
-	{
-		perror(CMD_CHANGE_DIRECTORY);
-		g_globi = 1;
-		return (0);
-	}
-	return (1);
+	char	*path;
+	size_t	len;
+	size_t	size;
+
+	size = strlen(dir) + 2;
+	if (dir[0] != '/' && !data->utils->logical_pwd.buffer)
+		return (NULL);
+	if (dir[0] != '/')
+		size += ft_strlen(data->utils->logical_pwd.buffer);
+	path = malloc_track(data, size);
+	if (!path)
+		return (NULL);
+	len = ZERO_INIT;
+	if (dir[0] != '/')
+		append_path_components(path, &len, data->utils->logical_pwd.buffer);
+	append_path_components(path, &len, dir);
+	if (!len)
+		ft_strcpy(path, "/");
+	return (path);
 }
 
-// recupere et retourn la variable d'env PWD, renvoi NULL si il le trouve pas
-char	*get_pwd_env(t_env	*tmp, t_data *data)
+int	set_logical_pwd(t_data *data, t_exec *utils, const char *path)
 {
-	tmp = data->utils->linked_list_full_env_var_copy_alpha;
-	while (tmp)
-	{
-		if (!strncmp(ENV_SET_CURRENT_WORKING_DIR,
-				tmp->var_env_name_and_value, 4))
-			return (tmp->var_env_name_and_value);
-		tmp = tmp->next_var_env_name_and_value;
-	}
-	return (NULL);
+	size_t	len;
+
+	len = strlen(path);
+	if (!reserve_hot_entry(data, &utils->logical_pwd, len + 1))
+		return (FALSE);
+	memcpy(utils->logical_pwd.buffer, path, len + 1);
+	return (TRUE);
 }
 
 /*
-	verifie et met a jour la variable d'env OLDPWD si elle est trouvee,
-	 renvoie 1 si la
-	maj a etait faite et 0 sinon
+	le PWD herite n'est garde que s'il est absolu et designe bien le
+	repertoire courant
 */
-int	verif_oldpwd(char *str, t_data *data)
+bool	is_valid_logical_pwd(t_env *pwd)
 {
-	t_env	*tmp;
-	char	*s1;
+	struct stat	logical;
+	struct stat	current;
+	char		*path;
 
-	tmp = data->utils->linked_list_full_env_var_copy_alpha;
-	while (tmp)
+	path = pwd->var_env_name_and_value + ft_strlen(ENV_CURRENT_WORKING_DIR);
+	if (*path != '=' || path[1] != '/')
+		return (false);
+	return (stat(path + 1, &logical) == 0 && stat(".", &current) == 0 \
+	&& logical.st_dev == current.st_dev && logical.st_ino == current.st_ino);
+}
+
+/*
+	le repertoire logique part du PWD herite s'il est valide, sinon du
+	chemin physique ; getcwd n'est plus appele ensuite que si cd doit
+	retomber sur le chemin physique
+*/
+void	init_logical_pwd(t_data *data, t_exec *utils)
+{
+	t_env	*pwd;
+	char	*cwd;
+
+	pwd = find_env_var_linear(utils, ENV_CURRENT_WORKING_DIR, \
+	ft_strlen(ENV_CURRENT_WORKING_DIR));
+	if (pwd && is_valid_logical_pwd(pwd))
 	{
-		if (ft_strncmp(tmp->var_env_name_and_value, ENV_SET_OLDPWD,
-				ft_str_len_until_equal(ENV_SET_OLDPWD)) == 0)
-		{
-			s1 = ft_strjoin_free_arg2_with_memory_tracking(\
-			ENV_SET_OLDPWD, str, data);
-			tmp->var_env_name_and_value = create_new_var(s1, data);
-			return (1);
-		}
-		tmp = tmp->next_var_env_name_and_value;
+		set_logical_pwd(data, utils, pwd->var_env_name_and_value \
+		+ ft_strlen(ENV_CURRENT_WORKING_DIR) + 1);
+		return ;
 	}
-	return (0);
+	cwd = getcwd(NULL, 0);
+	if (cwd)
+		set_logical_pwd(data, utils, cwd);
+	free(cwd);
 }
@@ -21,24 +21,10 @@ int	ft_strcmp(char *s1, char *s2)
 	si il le trouve et imprime si ce n'est pas en -n
 	en gros ecrit les argument du echo avec un -n
 */
-void	display_echo_arg(char **tab, int i, t_data *data)
+void	display_echo_arg(char **tab, int i, t_outbuf *out)
 {
 	i = i + 2;
-	if (data->utils->node->output_fd > 0)
-		write_echo_fd(tab, i, data);
-	else if (!data->utils->node->output_redirection_error_id)
-	{
-		while (tab[i])
-		{
-			if (ft_strcmp(tab[i], "-n"))
-			{
-				printf("%s", tab[i]);
-				if (tab[i + 1])
-					printf(" ");
-			}
-			i++;
-		}
-	}
+	write_echo_words_skipping_n(tab, i, out);
 }
 
 /*
@@ -55,48 +41,12 @@ void	get_words(t_lexer *lexer_lst, char **tab, int *i)
 }
 
 /*
-	elle decide ou afficher les arugment de echo separer par des space
-	la fonction commence par regarder si elle doit ecrire sur une sortie special
-	si c'est le cas elle ajoute une nouvelle ligne a la fin
-	si la sortie n'es pas special elle appel process_echo2
-	En gros elle decide ou ecrire et gere les erreurs
+	ecrit les arguments de echo separes par des espaces puis une nouvelle
+	ligne, dans le tampon de sortie du builtin (redirection ou stdout)
 */
-void	process_echo(char **tab, int i, t_data *data)
+void	process_echo(char **tab, int i, t_outbuf *out)
 {
-	int	j;
-
-	j = ZERO_INIT;
-	if (data->utils->node->output_fd > 0)
-	{
-		if (procc_in_echo_fd(tab, i, j, data) == -1)
-			return ;
-		ft_write_fd("\n", data->utils->node->output_fd);
-	}
-	else
-		procc_in_echo_std(tab, i, data);
+	write_echo_words(tab, i, out);
+	write_outbuf(out, "\n", 1);
 	g_globi = 0;
 }
-
-/*
-	la fonction ecri chaque argument apres le premier et ajoute un
-	espace entre chaque argument qui suivent
-	puis ajoute une nouvelle ligne a la fin
-*/
-void	procc_in_echo_std(char **tab, int i, t_data *data)
-{
-	int	j;
-
-	j = ZERO_INIT;
-	if (!data->utils->node->output_redirection_error_id)
-	{
-		while (tab[i])
-		{
-			if (j)
-				printf(" %s", tab[i++]);
-			else
-				printf("%s", tab[i++]);
-			j++;
-		}
-		printf("\n");
-	}
-}
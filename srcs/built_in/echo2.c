@@ -50,27 +50,28 @@ int	check_n(char *str)
 	commence par verifier si il y a un -n apres echo
 	puis si il un -n appel display_echo_arg et sinon apell process echo
 	enfin si nous somme dans aucun des deux cas la fonction ecrit elle
-	meme le retour a la ligne sur la sorti use
+	meme le retour a la ligne ; tout passe par un seul tampon de sortie
+	vide une fois a la fin
 */
 void	simulate_echo(char **tab, t_data *data)
 {
-	int	i;
-	int	ncount;
+	int			i;
+	int			ncount;
+	t_outbuf	*out;
 
 	i = ZERO_INIT;
+	out = start_builtin_output(data);
+	if (!out)
+		return ;
 	if (tab && tab[i] && tab[i + 1])
 		ncount = check_n(tab[i + 1]);
 	if (tab[i] && tab[i + 1] && !ft_strcmp(tab[i], CMD_ECHO)
 		&& tab[i + 1][0] != '-' && tab[i + 1][1] != 'n')
-		process_echo(tab, ++i, data);
+		process_echo(tab, ++i, out);
 	else if (tab[i] && tab[i + 1] && !ft_strcmp(tab[i], CMD_ECHO)
 		&& ncount)
-		display_echo_arg(tab, i, data);
+		display_echo_arg(tab, i, out);
 	else
-	{
-		if (data->utils->node->output_fd > 0)
-			ft_write_fd("\n", data->utils->node->output_fd);
-		else
-			printf("\n");
-	}
+		write_outbuf(out, "\n", 1);
+	finish_builtin_output(data);
 }
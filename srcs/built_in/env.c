@@ -53,36 +53,27 @@ int	check_env(t_lexer *lexer_lst, t_data *data)
 }
 
 /*
-	Utilise g_all.utils->node->output_fd pour déterminer si l'affichage
-	doit être redirigé ou pas la fonction parcour la list des variable
-	d'env (env_lst) et les affiche suivi d'une nouvelle ligne entre chaque
-	si il n'y a pas de redirection, elle use printf pour les afficher dans
-	le terminal
+	parcour la list des variable d'env (env_lst) et les ecrit suivi d'une
+	nouvelle ligne dans le tampon de sortie du builtin, qui vise la
+	redirection du noeud ou le terminal ; un seul write pour tout l'env
+	tant qu'il tient dans le tampon
 */
 void	display_env(t_data *data)
 {
-	t_env	*current;
+	t_env		*current;
+	t_outbuf	*out;
 
+	out = start_builtin_output(data);
+	if (!out)
+		return ;
 	current = data->utils->linked_list_full_env_var_copy_alpha;
-	if (data->utils->node->output_fd > 0)
+	while (current)
 	{
-		while (current)
-		{
-			if (ft_write_fd(current->var_env_name_and_value, \
-			data->utils->node->output_fd))
-				return ;
-			ft_write_fd("\n", data->utils->node->output_fd);
-			current = current->next_var_env_name_and_value;
-		}
-	}
-	else if (!data->utils->node->output_redirection_error_id)
-	{
-		while (current)
-		{
-			printf("%s\n", current->var_env_name_and_value);
-			current = current->next_var_env_name_and_value;
-		}
+		puts_outbuf(out, current->var_env_name_and_value);
+		write_outbuf(out, "\n", 1);
+		current = current->next_var_env_name_and_value;
 	}
+	finish_builtin_output(data);
 }
 
 /*
@@ -18,6 +18,8 @@ t_env	*create_node_str(char *str, t_data *data)
 	node = malloc_track(data, sizeof(t_env));
 	if (!node)
 		return (NULL);
+	keep_env_memory(data, node);
+	keep_env_memory(data, str);
 	node->var_env_name_and_value = str;
 	node->next_var_env_name_and_value = NULL;
 	return (node);
@@ -28,17 +30,22 @@ t_env	*create_node_str(char *str, t_data *data)
 	elle cree un noeud et le defini comme le premier noeud
 	si la list contient deja des elem, elle parcou la list jusqu'au
 	dernier elem puis cree un nouveau noeud avec str en utilissant
-	create_node_str et l'ajoute a la fin de la liste
+	create_node_str et l'ajoute a la fin de la liste.
+	On part de la tete courante de la liste (et non de head_env_lst, qui
+	peut designer un noeud retire par unset) et l'index est perime.
 */
 void	lst_add_back(t_exec *utils, char *str, t_data *data)
 {
 	t_env	*current;
 	t_env	*head;
 
-	head = utils->head_env_lst;
+	mark_env_index_stale(utils);
+	head = utils->linked_list_full_env_var_copy_alpha;
 	if (head == NULL)
 	{
-		head = create_node_str(str, data);
+		utils->linked_list_full_env_var_copy_alpha = \
+		create_node_str(str, data);
+		utils->head_env_lst = utils->linked_list_full_env_var_copy_alpha;
 	}
 	else
 	{
@@ -29,15 +29,22 @@ void	remove_node(char *var, t_data *data)
 	Si le nœud à supprimer est le premier de la liste (prev est NULL),
 	met à jour la tête de la liste. Sinon, ajuste le pointeur next du
 	nœud précédent pour exclure le nœud courant.
+	Le noeud et sa valeur sont rendus a la ligne en cours.
 */
 void	remove_env_node(t_env *current, t_env *prev, t_data *data)
 {
+	mark_env_index_stale(data->utils);
 	if (!prev)
+	{
 		data->utils->linked_list_full_env_var_copy_alpha = \
 		current->next_var_env_name_and_value;
+		data->utils->head_env_lst = current->next_var_env_name_and_value;
+	}
 	else
 		prev->next_var_env_name_and_value = \
 		current->next_var_env_name_and_value;
+	drop_env_memory(data, current);
+	release_env_value(data, current->var_env_name_and_value);
 }
 
 /*
@@ -70,7 +77,8 @@ void	remove_node_export(char *var, t_data *data)
 	Si le nœud à supprimer est le premier de la liste (prev est NULL),
 	 met à jour la tête
 	de la liste. Sinon, ajuste le pointeur next du nœud précédent pour
-	 exclure le nœud courant.
+	 exclure le nœud courant. Comme pour remove_env_node, le noeud et sa
+	 valeur sont rendus a la ligne.
 */
 void	remove_export_node(t_export *current, t_export *prev, t_data *data)
 {
@@ -80,4 +88,6 @@ void	remove_export_node(t_export *current, t_export *prev, t_data *data)
 	else
 		prev->next_env_var_name_and_value = \
 		current->next_env_var_name_and_value;
+	drop_env_memory(data, current);
+	release_env_value(data, current->env_var_name_and_value);
 }
@@ -3,39 +3,35 @@
 /*
 	Cette fonction parcourt et affiche la liste des variables exporter
 	elle affiche declare -x suivie de la valeur de la variable
-	on utilise write fd quand on veux ecrire dans un fd special ou
-	printf pour l'affiche standard
+	tout passe par le tampon de sortie du builtin, vide une fois a la fin
 */
 void	print_export(t_export *head_of_linked_list_env_var, t_data *data)
 {
 	t_export	*current;
+	t_outbuf	*out;
 
+	out = start_builtin_output(data);
+	if (!out)
+		return ;
 	current = head_of_linked_list_env_var;
 	while (current != NULL)
 	{
-		if (data->utils->node->output_fd > 0)
-		{
-			ft_write_fd("declare -x ", data->utils->node->output_fd);
-			ft_write_fd(current->env_var_name_and_value, \
-			data->utils->node->output_fd);
-			ft_write_fd("\n", data->utils->node->output_fd);
-		}
-		else if (!data->utils->node->output_redirection_error_id)
-		{
-			printf("declare -x ");
-			printf("%s\n", current->env_var_name_and_value);
-		}
+		puts_outbuf(out, "declare -x ");
+		puts_outbuf(out, current->env_var_name_and_value);
+		write_outbuf(out, "\n", 1);
 		current = current->next_env_var_name_and_value;
 	}
-	current = head_of_linked_list_env_var;
 	g_globi = 0;
+	finish_builtin_output(data);
 }
 
-//check la syntaxe de chaque mot grace a check_parsing_export 1 a 1
-int	export_parsing_syntaxe(t_lexer *tmp, t_data *data)
+/*
+	check la syntaxe de chaque mot grace a check_parsing_export 1 a 1,
+	uniquement dans le segment de export (jusqu'au prochain pipe)
+*/
+int	export_parsing_syntaxe(t_lexer *tmp)
 {
-	tmp = data->utils->head_lexer_lst;
-	while (tmp)
+	while (tmp && tmp->token != PIPE)
 	{
 		if (check_parsing_export(tmp->cmd_segment) == 1)
 			return (1);
@@ -88,10 +84,9 @@ void	process_word_and_add_export(t_lexer *tmp, t_data *data)
 */
 void	export_remaining(t_lexer *tmp, t_data *data)
 {
-	if (export_parsing_syntaxe(tmp, data))
+	if (export_parsing_syntaxe(tmp))
 		return ;
-	tmp = data->utils->head_lexer_lst;
-	while (tmp)
+	while (tmp && tmp->token != PIPE)
 	{
 		if (tmp->token == ARG)
 			process_word_and_add_export(tmp, data);
@@ -16,8 +16,8 @@ void	export_quotes(t_export *don, t_data *data)
 	{
 		if (check_case(tmp->env_var_name_and_value) && \
 		check_case_with_char(tmp->env_var_name_and_value))
-			tmp->env_var_name_and_value = case_egale(\
-			tmp->env_var_name_and_value, data);
+			replace_env_value(data, &tmp->env_var_name_and_value, \
+			case_egale(tmp->env_var_name_and_value, data));
 		tmp = tmp->next_env_var_name_and_value;
 	}
 	tmp = don;
@@ -70,7 +70,7 @@ void	supp_quote_and_add_env(t_exec **utils, t_lexer *tmp, t_data *data)
 	remove_double_quotes(tmp->cmd_segment);
 	remove_single_quotes(tmp->cmd_segment);
 	if (verif_equal(tmp->cmd_segment, '=') && \
-	verif_var_exist(*utils, tmp->cmd_segment) == 0)
+	verif_var_exist(*utils, tmp->cmd_segment, data) == 0)
 	{
 		lst_add_back(*utils, tmp->cmd_segment, data);
 	}
@@ -12,6 +12,8 @@ t_export	*create_node_str_export(char *str, t_data *data)
 	node = malloc_track(data, sizeof(t_export));
 	if (node)
 	{
+		keep_env_memory(data, node);
+		keep_env_memory(data, str);
 		node->env_var_name_and_value = str;
 		node->next_env_var_name_and_value = NULL;
 	}
@@ -20,7 +20,8 @@ int	check_parsing_char(char *str, int i)
 		|| str[i] == '\"')
 	{
 		g_globi = 1;
-		ft_printf("minishell: export : `%s': not a valid identifier\n", str);
+		ft_dprintf(STDERR_FILENO, \
+		"minishell: export : `%s': not a valid identifier\n", str);
 		return (1);
 	}
 	return (0);
@@ -41,7 +42,7 @@ int	check_parsing_error(char *str)
 		{
 			str += i;
 			g_globi = 0;
-			ft_printf("minishell: %s event not found\n", str);
+			ft_dprintf(STDERR_FILENO, "minishell: %s event not found\n", str);
 			return (1);
 		}
 		if (check_parsing_char(str, i) == 1)
@@ -50,7 +51,7 @@ int	check_parsing_error(char *str)
 					&& str[1] == '\'')) && str[2] == '\0')
 		{
 			g_globi = 1;
-			ft_printf(\
+			ft_dprintf(STDERR_FILENO, \
 			"minishell: export : `%s': not a valid identifier\n", str);
 			return (1);
 		}
@@ -71,13 +72,15 @@ int	check_parsing_export(char *str)
 		|| (*str == '-' && !str[1]))
 	{
 		g_globi = 1;
-		ft_printf("minishell: export : `%s': not a valid identifier\n", str);
+		ft_dprintf(STDERR_FILENO, \
+		"minishell: export : `%s': not a valid identifier\n", str);
 		return (1);
 	}
 	else if (*str == '-')
 	{
 		g_globi = 2;
-		ft_printf("minishell: export: %c%c: invalid option\n", str[0], str[1]);
+		ft_dprintf(STDERR_FILENO, \
+		"minishell: export: %c%c: invalid option\n", str[0], str[1]);
 		return (1);
 	}
 	if (check_parsing_error(str) == 1)
@@ -21,7 +21,8 @@ int	verif_var_exist_export(t_exec *utils, char *str, t_data *data)
 		{
 			if (verif_equal(str, '=') && (ft_str_len_until_equal(\
 			str) == ft_str_len_until_equal(tmp->env_var_name_and_value)))
-				tmp->env_var_name_and_value = case_egale(str, data);
+				replace_env_value(data, \
+				&tmp->env_var_name_and_value, case_egale(str, data));
 			return (1);
 		}
 		tmp = tmp->next_env_var_name_and_value;
@@ -48,7 +49,7 @@ int	verif_equal(char *str, char c)
 	(env_lst) en comparant str avec le contenu de chaque noeud
 	si il trouve il met a jour la variable d'env avec str
 */
-int	verif_var_exist(t_exec *utils, char *str)
+int	verif_var_exist(t_exec *utils, char *str, t_data *data)
 {
 	t_env	*tmp;
 
@@ -60,8 +61,7 @@ int	verif_var_exist(t_exec *utils, char *str)
 						->var_env_name_and_value))) && (ft_str_len_until_equal
 				(str) == ft_str_len_until_equal(tmp->var_env_name_and_value)))
 		{
-			tmp->var_env_name_and_value = str;
-			tmp = utils->linked_list_full_env_var_copy_alpha;
+			replace_env_value(data, &tmp->var_env_name_and_value, str);
 			return (1);
 		}
 		tmp = tmp->next_var_env_name_and_value;
@@ -44,12 +44,24 @@ int	is_valid_number(char *str)
 	return (is_valid_number2(neg, str, i));
 }
 
-// ferme les pipes et descripteurs de fichier ouvert avant l'exit
-void	free_res(int *fd, t_data *data)
+/*
+	ferme les pipes et descripteurs de fichier ouvert puis sort.
+	Embarque (libminishell), le processus hote ne sort pas : le code est
+	garde dans g_globi et l'entree est fermee, ms_run_line s'arrete la ;
+	les fds sont fermes par la suite normale de l'execution.
+*/
+void	leave_shell(int *fd, t_data *data, unsigned char exit_code)
 {
+	if (is_embedded_parent(data))
+	{
+		g_globi = exit_code;
+		data->input.is_closed = TRUE;
+		return ;
+	}
 	closes_ends_of_pipe(fd);
 	close_file_descriptors_in_linked_list(data);
 	ft_free_all(data);
+	exit_shell_process(data, exit_code);
 }
 
 // check i il y a trop d'argument et sinons'occupe de sortir
@@ -58,14 +70,13 @@ void	ft_exit_with_code(t_lexer *lex, int *fd, unsigned char exit_code,
 {
 	if (lex->next->next)
 	{
-		ft_printf("minishell: exit: too many arguments\n");
+		ft_dprintf(STDERR_FILENO, "minishell: exit: too many arguments\n");
 		g_globi = 1;
 	}
 	else
 	{
 		exit_code = ft_atoll(lex->next->cmd_segment);
-		free_res(fd, data);
-		exit (exit_code);
+		leave_shell(fd, data, exit_code);
 	}
 }
 
@@ -81,23 +92,20 @@ void	ft_exit(t_lexer *lex, int *fd, t_data *data)
 	unsigned char	exit_code;
 
 	exit_code = 0;
-	if (data->utils->nb_cmd_in_lst == 1)
+	if (data->utils->nb_cmd_in_lst == 1 && is_interactive_input(data))
 		write(1, "exit\n", 5);
 	if (lex->next)
 	{
 		if (is_valid_number(lex->next->cmd_segment))
 		{
-			ft_printf("minishell: exit: %s: numeric argument required\n", \
+			ft_dprintf(STDERR_FILENO, \
+			"minishell: exit: %s: numeric argument required\n", \
 			lex->next->cmd_segment);
-			free_res(fd, data);
-			exit(2);
+			leave_shell(fd, data, 2);
 		}
 		else
 			ft_exit_with_code(lex, fd, exit_code, data);
 	}
 	else
-	{
-		free_res(fd, data);
-		exit (exit_code);
-	}
+		leave_shell(fd, data, exit_code);
 }
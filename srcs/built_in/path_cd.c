@@ -20,8 +20,8 @@ int	verif_oldpwd_export(char *str, t_data *data)
 		{
 			s1 = ft_strjoin_free_arg2_with_memory_tracking(\
 			ENV_SET_OLDPWD, str, data);
-			tmp->env_var_name_and_value = create_new_var(s1, data);
-			tmp->env_var_name_and_value = case_egale(s1, data);
+			replace_env_value(data, \
+			&tmp->env_var_name_and_value, case_egale(s1, data));
 			return (1);
 		}
 		tmp = tmp->next_env_var_name_and_value;
@@ -44,8 +44,8 @@ int	verif_pwd_export(char *str, t_data *data)
 		{
 			s1 = ft_strjoin_free_arg2_with_memory_tracking(\
 			ENV_SET_CURRENT_WORKING_DIR, str, data);
-			tmp->env_var_name_and_value = create_new_var(s1, data);
-			tmp->env_var_name_and_value = case_egale(s1, data);
+			replace_env_value(data, \
+			&tmp->env_var_name_and_value, case_egale(s1, data));
 			return (1);
 		}
 		tmp = tmp->next_env_var_name_and_value;
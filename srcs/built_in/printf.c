@@ -0,0 +1,76 @@
+#include "../../include/minishell.h"
+
+/*
+	Argument numerique : decimal, 0x hexadecimal ou 0 octal, ou 'c pour
+	le code du caractere. Un argument invalide est signale, la partie
+	deja lue est gardee.
+*/
+long long	parse_printf_number(t_printf *pf, char *arg)
+{
+	long long	value;
+	char		*end;
+
+	if (!arg || !*arg)
+		return (0);
+	if (arg[0] == '\'' || arg[0] == '"')
+		return ((unsigned char)arg[1]);
+	errno = 0;
+	value = strtoll(arg, &end, 0);
+	if (end == arg || *end)
+		report_printf_error(pf, arg, "invalid number");
+	else if (errno == ERANGE)
+		report_printf_error(pf, arg, "Result too large");
+	return (value);
+}
+
+/*
+	Un passage sur le format : le texte brut est copie par morceaux, les
+	sequences \ et les conversions % sont traitees au fil de l'eau.
+*/
+void	write_printf_pass(t_printf *pf, const char *format)
+{
+	size_t	span;
+
+	while (*format && !pf->is_stopped)
+	{
+		span = strcspn(format, "\\%");
+		write_outbuf(pf->out, format, span);
+		format += span;
+		if (*format == '\\')
+			format += write_printf_escape(pf, format, FALSE);
+		else if (*format == '%')
+			format += write_printf_conversion(pf, format);
+	}
+}
+
+/*
+	printf FORMAT [ARG...] dans le tampon de sortie du builtin. Le format
+	est repris tant qu'il reste des arguments et qu'il en consomme.
+*/
+void	ft_printf_builtin(t_lexer *lexer_lst, t_data *data)
+{
+	t_printf	pf;
+	char		**argv;
+	int			argc;
+	int			first;
+
+	argv = collect_builtin_args(lexer_lst, data, &argc);
+	first = 1;
+	if (argv && argc > 2 && !strcmp(argv[1], "--"))
+		first = 2;
+	if (!argv || argc <= first)
+	{
+		ft_dprintf(STDERR_FILENO, ERR_PRINTF_USAGE);
+		g_globi = 2;
+		return ;
+	}
+	pf.out = start_builtin_output(data);
+	if (!pf.out)
+		return ;
+	init_printf(&pf, argv + first, argc - first);
+	write_printf_pass(&pf, pf.format);
+	while (!pf.is_stopped && pf.index > 0 && pf.index < pf.nb_args)
+		write_printf_pass(&pf, pf.format);
+	g_globi = pf.status;
+	finish_builtin_output(data);
+}
@@ -0,0 +1,113 @@
+#include "../../include/minishell.h"
+
+int	parse_printf_digits(const char *str, int base, int max_digits, int *value)
+{
+	int	count;
+	int	digit;
+
+	count = ZERO_INIT;
+	*value = ZERO_INIT;
+	while (count < max_digits && str[count])
+	{
+		digit = -1;
+		if (str[count] >= '0' && str[count] <= '9')
+			digit = str[count] - '0';
+		else if (str[count] >= 'a' && str[count] <= 'f')
+			digit = str[count] - 'a' + 10;
+		else if (str[count] >= 'A' && str[count] <= 'F')
+			digit = str[count] - 'A' + 10;
+		if (digit < 0 || digit >= base)
+			break ;
+		*value = *value * base + digit;
+		count++;
+	}
+	return (count);
+}
+
+char	get_printf_escape_char(char c)
+{
+	const char	*from;
+	const char	*to;
+	char		*found;
+
+	from = "\\abfnrtv\"'";
+	to = "\\\a\b\f\n\r\t\v\"'";
+	found = strchr(from, c);
+	if (!c || !found)
+		return ('\0');
+	return (to[found - from]);
+}
+
+/*
+	\xHH, \NNN et, dans un argument %b, \0NNN ; renvoie 0 si str n'est
+	pas une sequence numerique.
+*/
+int	write_printf_numeric_escape(t_printf *pf, const char *str, int is_arg)
+{
+	int		len;
+	int		value;
+	char	c;
+
+	if (str[1] == 'x')
+	{
+		len = parse_printf_digits(str + 2, 16, 2, &value);
+		if (!len)
+			return (ZERO_INIT);
+		len += 2;
+	}
+	else if (is_arg && str[1] == '0')
+		len = parse_printf_digits(str + 2, 8, 3, &value) + 2;
+	else if (str[1] >= '0' && str[1] <= '7')
+		len = parse_printf_digits(str + 1, 8, 3, &value) + 1;
+	else
+		return (ZERO_INIT);
+	c = (char)value;
+	write_outbuf(pf->out, &c, 1);
+	return (len);
+}
+
+/*
+	Sequence \ du format, ou d'un argument %b si is_arg (ou \c arrete
+	toute la sortie) ; renvoie le nombre de caracteres lus.
+*/
+int	write_printf_escape(t_printf *pf, const char *str, int is_arg)
+{
+	int		len;
+	char	c;
+
+	if (is_arg && str[1] == 'c')
+	{
+		pf->is_stopped = TRUE;
+		return (2);
+	}
+	len = write_printf_numeric_escape(pf, str, is_arg);
+	if (len)
+		return (len);
+	c = get_printf_escape_char(str[1]);
+	if (c)
+	{
+		write_outbuf(pf->out, &c, 1);
+		return (2);
+	}
+	if (!str[1])
+	{
+		write_outbuf(pf->out, "\\", 1);
+		return (1);
+	}
+	write_outbuf(pf->out, str, 2);
+	return (2);
+}
+
+void	write_printf_escaped_arg(t_printf *pf, const char *arg)
+{
+	size_t	span;
+
+	while (*arg && !pf->is_stopped)
+	{
+		span = strcspn(arg, "\\");
+		write_outbuf(pf->out, arg, span);
+		arg += span;
+		if (*arg == '\\')
+			arg += write_printf_escape(pf, arg, TRUE);
+	}
+}
@@ -0,0 +1,52 @@
+#include "../../include/minishell.h"
+
+double	parse_printf_double(t_printf *pf, char *arg)
+{
+	double	value;
+	char	*end;
+
+	if (!*arg)
+		return (0);
+	if (arg[0] == '\'' || arg[0] == '"')
+		return ((unsigned char)arg[1]);
+	errno = 0;
+	value = strtod(arg, &end);
+	if (end == arg || *end)
+		report_printf_error(pf, arg, "invalid number");
+	else if (errno == ERANGE)
+		report_printf_error(pf, arg, "Result too large");
+	return (value);
+}
+
+/*
+	%f, %e et %g : un flottant tres grand peut depasser le tampon meme
+	avec une largeur bornee, la sortie est alors allouee a la taille.
+*/
+void	write_printf_float(t_printf *pf, t_printf_spec *spec, char *arg)
+{
+	char	format[PRINTF_FORMAT_SIZE];
+	char	buffer[PRINTF_NUMBER_SIZE];
+	char	*output;
+	double	value;
+	int		len;
+
+	value = parse_printf_double(pf, arg);
+	if (spec->precision >= 0)
+		snprintf(format, PRINTF_FORMAT_SIZE, "%%%s%d.%d%c", \
+		spec->flags, spec->width, spec->precision, spec->conv);
+	else
+		snprintf(format, PRINTF_FORMAT_SIZE, "%%%s%d%c", \
+		spec->flags, spec->width, spec->conv);
+	output = buffer;
+	len = snprintf(buffer, PRINTF_NUMBER_SIZE, format, value);
+	if (len >= PRINTF_NUMBER_SIZE)
+	{
+		output = malloc(len + 1);
+		if (output)
+			snprintf(output, len + 1, format, value);
+	}
+	if (output && len > 0)
+		write_outbuf(pf->out, output, len);
+	if (output != buffer)
+		free(output);
+}
@@ -0,0 +1,123 @@
+#include "../../include/minishell.h"
+
+/*
+	Largeur ou precision, bornee a PRINTF_WIDTH_MAX pour que toute
+	conversion numerique tienne dans PRINTF_NUMBER_SIZE.
+*/
+int	parse_printf_bound(const char *str, int *i)
+{
+	int	value;
+
+	value = ZERO_INIT;
+	while (str[*i] >= '0' && str[*i] <= '9')
+	{
+		if (value < PRINTF_WIDTH_MAX)
+			value = value * 10 + (str[*i] - '0');
+		(*i)++;
+	}
+	if (value > PRINTF_WIDTH_MAX)
+		value = PRINTF_WIDTH_MAX;
+	return (value);
+}
+
+/*
+	Lit drapeaux, largeur et precision apres le '%' ; renvoie la position
+	du caractere de conversion.
+*/
+int	parse_printf_spec(const char *str, t_printf_spec *spec)
+{
+	int	i;
+	int	nb_flags;
+
+	i = 1;
+	nb_flags = ZERO_INIT;
+	while (str[i] && ft_strchr(PRINTF_FLAGS, str[i]))
+	{
+		if (nb_flags < PRINTF_FLAGS_MAX)
+			spec->flags[nb_flags++] = str[i];
+		i++;
+	}
+	spec->flags[nb_flags] = '\0';
+	spec->width = parse_printf_bound(str, &i);
+	spec->precision = -1;
+	if (str[i] == '.')
+	{
+		i++;
+		spec->precision = parse_printf_bound(str, &i);
+	}
+	spec->conv = str[i];
+	return (i);
+}
+
+void	write_printf_string(t_printf *pf, t_printf_spec *spec, \
+const char *str, int len)
+{
+	int	pad;
+
+	pad = spec->width - len;
+	while (!ft_strchr(spec->flags, '-') && pad-- > 0)
+		write_outbuf(pf->out, " ", 1);
+	write_outbuf(pf->out, str, len);
+	while (pad-- > 0)
+		write_outbuf(pf->out, " ", 1);
+}
+
+/*
+	Les conversions numeriques passent par snprintf avec un format
+	reconstruit a partir de la specification bornee.
+*/
+void	write_printf_number(t_printf *pf, t_printf_spec *spec, char *arg)
+{
+	char		format[PRINTF_FORMAT_SIZE];
+	char		buffer[PRINTF_NUMBER_SIZE];
+	long long	value;
+	int			len;
+
+	value = parse_printf_number(pf, arg);
+	if (spec->precision >= 0)
+		snprintf(format, PRINTF_FORMAT_SIZE, "%%%s%d.%dll%c", \
+		spec->flags, spec->width, spec->precision, spec->conv);
+	else
+		snprintf(format, PRINTF_FORMAT_SIZE, "%%%s%dll%c", \
+		spec->flags, spec->width, spec->conv);
+	if (spec->conv == 'd' || spec->conv == 'i')
+		len = snprintf(buffer, PRINTF_NUMBER_SIZE, format, value);
+	else
+		len = snprintf(buffer, PRINTF_NUMBER_SIZE, format, \
+		(unsigned long long)value);
+	if (len > 0)
+		write_outbuf(pf->out, buffer, len);
+}
+
+/*
+	Traite une conversion ; renvoie le nombre de caracteres du format
+	consommes. Un caractere de conversion inconnu arrete la sortie.
+*/
+int	write_printf_conversion(t_printf *pf, const char *str)
+{
+	t_printf_spec	spec;
+	int				i;
+	char			*arg;
+
+	if (str[1] == '%')
+	{
+		write_outbuf(pf->out, "%", 1);
+		return (2);
+	}
+	i = parse_printf_spec(str, &spec);
+	if (!spec.conv || !ft_strchr("sbcdiuxXofeEgG", spec.conv))
+		return (stop_printf_on_bad_conversion(pf, str, i));
+	arg = next_printf_arg(pf);
+	if (!arg)
+		arg = "";
+	if (spec.conv == 'b')
+		write_printf_escaped_arg(pf, arg);
+	else if (spec.conv == 's' || spec.conv == 'c')
+		write_printf_string(pf, &spec, arg, \
+		get_printf_string_length(&spec, arg));
+	else if (ft_strchr("feEgG", spec.conv))
+		write_printf_float(pf, &spec, arg);
+	else
+		write_printf_number(pf, &spec, arg);
+	return (i + 1);
+}
@@ -0,0 +1,59 @@
+#include "../../include/minishell.h"
+
+/*
+	argv commence au format, les arguments suivent.
+*/
+void	init_printf(t_printf *pf, char **argv, int argc)
+{
+	pf->format = argv[0];
+	pf->args = argv + 1;
+	pf->nb_args = argc - 1;
+	pf->index = ZERO_INIT;
+	pf->status = ZERO_INIT;
+	pf->is_stopped = FALSE;
+}
+
+char	*next_printf_arg(t_printf *pf)
+{
+	if (pf->index >= pf->nb_args)
+		return (NULL);
+	return (pf->args[pf->index++]);
+}
+
+void	report_printf_error(t_printf *pf, char *arg, char *msg)
+{
+	ft_dprintf(STDERR_FILENO, "minishell: printf: %s: %s\n", arg, msg);
+	pf->status = 1;
+}
+
+int	get_printf_string_length(t_printf_spec *spec, char *arg)
+{
+	int	len;
+
+	len = ft_strlen(arg);
+	if (spec->conv == 'c' && len > 1)
+		return (1);
+	if (spec->conv == 's' && spec->precision >= 0 && spec->precision < len)
+		return (spec->precision);
+	return (len);
+}
+
+int	stop_printf_on_bad_conversion(t_printf *pf, const char *str, int i)
+{
+	char	quoted[4];
+
+	if (!str[i])
+		ft_dprintf(STDERR_FILENO, \
+		"minishell: printf: `%s': missing format character\n", str);
+	else
+	{
+		quoted[0] = '`';
+		quoted[1] = str[i];
+		quoted[2] = '\'';
+		quoted[3] = '\0';
+		report_printf_error(pf, quoted, "invalid format character");
+	}
+	pf->status = 1;
+	pf->is_stopped = TRUE;
+	return (i + (str[i] != '\0'));
+}
@@ -19,70 +19,56 @@ int	get_pwd(char *tab, t_data *data)
 	return (0);
 }
 
+void	write_pwd_line(t_data *data, char *path)
+{
+	t_outbuf	*out;
+
+	out = start_builtin_output(data);
+	g_globi = 0;
+	if (out)
+	{
+		puts_outbuf(out, path);
+		write_outbuf(out, "\n", 1);
+		finish_builtin_output(data);
+	}
+}
+
 /*
-	elle va afficher la ou on est (repertoir de travail actuel)
-	use getcwd pour ca et gere les erreur si il echoue
+	elle va afficher la ou on est (repertoir de travail actuel) : le
+	repertoire logique tenu a jour par cd, sans appel systeme ; getcwd
+	seulement si le shell ne le connait pas, en gerant l'erreur
 */
 void	display_pwd(t_data *data)
 {
-	char	*tmp;
+	char		*tmp;
 
+	if (data->utils->logical_pwd.buffer)
+	{
+		write_pwd_line(data, data->utils->logical_pwd.buffer);
+		return ;
+	}
 	tmp = getcwd(NULL, 0);
 	if (tmp == NULL)
 	{
-		ft_printf("error retrieving current directory: " \
+		ft_dprintf(STDERR_FILENO, "error retrieving current directory: " \
 		"No such file or directory\n");
 		g_globi = 1;
-		free(tmp);
 		return ;
 	}
-	if (data->utils->node->output_fd > 0)
-	{
-		ft_write_fd(tmp, data->utils->node->output_fd);
-		ft_write_fd("\n", data->utils->node->output_fd);
-	}
-	else if (!data->utils->node->output_redirection_error_id)
-	{
-		printf("%s\n", tmp);
-	}
-	g_globi = 0;
+	write_pwd_line(data, tmp);
 	free(tmp);
 }
 
 // affiche une erreur si pwd est use avec des arugument
 void	display_pwd_error(t_data *data)
 {
-	if (data->utils->node->output_fd > 0)
-	{
-		ft_write_fd("pwd: too many arguments", data->utils->node->output_fd);
-	}
-	else if (!data->utils->node->output_redirection_error_id)
-	{
-		printf("pwd: too many arguments");
-	}
-	g_globi = 1;
-}
-
-/*
-	OLDPWD stock le chemin du dernier repertoire de travail
-	parcour la list des variable d'env et change de repertoire si
-	il trouve OLDPWD
-	OLDPWD se souvient de ou tu es avant de faire pwd,
-	pour y revenir si on fait un cd
-*/
-void	find_old_pwd(t_env *env, t_data *data)
-{
-	t_env	*tmp;
+	t_outbuf	*out;
 
-	tmp = env;
-	while (tmp)
+	out = start_builtin_output(data);
+	if (out)
 	{
-		if (!ft_strncmp(tmp->var_env_name_and_value, \
-		ENV_PREVIOUS_WORKING_DIR, 6))
-		{
-			change_directory_for_oldpwd(env, data);
-			break ;
-		}
-		tmp = tmp->next_var_env_name_and_value;
+		puts_outbuf(out, "pwd: too many arguments");
+		finish_builtin_output(data);
 	}
+	g_globi = 1;
 }
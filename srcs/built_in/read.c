@@ -0,0 +1,100 @@
+#include "../../include/minishell.h"
+
+/*
+	Seule l'option -r est reconnue ; renvoie l'indice du premier nom, ou
+	-1 si une option est invalide.
+*/
+int	parse_read_options(char **argv, t_read_line *line)
+{
+	int	i;
+
+	i = 1;
+	line->is_raw = FALSE;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1])
+	{
+		if (!strcmp(argv[i], "--"))
+			return (i + 1);
+		if (strcmp(argv[i], "-r"))
+		{
+			ft_dprintf(STDERR_FILENO, ERR_READ_INVALID_OPTION, argv[i]);
+			return (-1);
+		}
+		line->is_raw = TRUE;
+		i++;
+	}
+	return (i);
+}
+
+int	check_read_names(char **names)
+{
+	while (*names)
+	{
+		if (!is_valid_read_name(*names))
+		{
+			ft_dprintf(STDERR_FILENO, ERR_READ_INVALID_NAME, *names);
+			return (FALSE);
+		}
+		names++;
+	}
+	return (TRUE);
+}
+
+/*
+	Remplace la valeur dans son noeud si la variable existe (via l'index),
+	sinon l'ajoute ; la liste d'export n'est mise a jour que si elle la
+	contient deja.
+*/
+void	assign_read_var(t_data *data, char *name, const char *value, size_t len)
+{
+	t_env	*env;
+	char	*entry;
+	size_t	name_len;
+
+	name_len = ft_strlen(name);
+	entry = malloc_track(data, name_len + len + 2);
+	if (!entry)
+		return ;
+	memcpy(entry, name, name_len);
+	entry[name_len] = '=';
+	if (len)
+		memcpy(entry + name_len + 1, value, len);
+	entry[name_len + len + 1] = '\0';
+	env = find_env_var(data, name, name_len);
+	if (env)
+		replace_env_value(data, &env->var_env_name_and_value, entry);
+	else
+		lst_add_back(data->utils, entry, data);
+	verif_var_exist_export(data->utils, entry, data);
+}
+
+/*
+	read [-r] [nom...] : lit une ligne sur l'entree du builtin et la
+	decoupe sur IFS. Renvoie 1 a la fin de l'entree, 2 sur une option
+	invalide.
+*/
+void	ft_read(t_lexer *lexer_lst, t_data *data)
+{
+	t_read_line	line;
+	char		**argv;
+	int			argc;
+	int			first;
+
+	argv = collect_builtin_args(lexer_lst, data, &argc);
+	if (!argv)
+		return ;
+	first = parse_read_options(argv, &line);
+	if (first < 0)
+	{
+		g_globi = 2;
+		return ;
+	}
+	if (!check_read_names(argv + first))
+	{
+		g_globi = 1;
+		return ;
+	}
+	init_read_line(&line, get_builtin_input_fd(data));
+	g_globi = !read_builtin_line(&line);
+	assign_read_fields(data, &line, argv + first);
+	free_read_line(&line);
+}
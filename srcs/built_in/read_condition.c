@@ -0,0 +1,25 @@
+#include "../../include/minishell.h"
+
+bool	is_read_ifs(t_read_line *line, const char *ifs, size_t i)
+{
+	return (!line->is_escaped[i] && line->buffer[i] \
+	&& strchr(ifs, line->buffer[i]));
+}
+
+bool	is_read_ifs_space(t_read_line *line, const char *ifs, size_t i)
+{
+	return (is_read_ifs(line, ifs, i) && (line->buffer[i] == ' ' \
+	|| line->buffer[i] == '\t' || line->buffer[i] == '\n'));
+}
+
+bool	is_valid_read_name(const char *name)
+{
+	int	i;
+
+	if (name[0] >= '0' && name[0] <= '9')
+		return (false);
+	i = ZERO_INIT;
+	while (ft_isalnum(name[i]) || name[i] == '_')
+		i++;
+	return (i > 0 && name[i] == '\0');
+}
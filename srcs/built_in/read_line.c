@@ -0,0 +1,112 @@
+#include "../../include/minishell.h"
+
+/*
+	Sur un fichier regulier on lit par blocs et on revient juste apres le
+	'\n' avec lseek ; sur un pipe ou un terminal on lit octet par octet,
+	pour ne rien prendre au-dela de la ligne.
+*/
+void	init_read_line(t_read_line *line, int fd)
+{
+	struct stat	st;
+
+	line->buffer = NULL;
+	line->is_escaped = NULL;
+	line->len = ZERO_INIT;
+	line->capacity = ZERO_INIT;
+	line->fd = fd;
+	line->has_backslash = FALSE;
+	line->is_seekable = (fstat(fd, &st) == 0 && S_ISREG(st.st_mode));
+}
+
+void	free_read_line(t_read_line *line)
+{
+	free(line->buffer);
+	free(line->is_escaped);
+}
+
+/*
+	Chaque caractere garde a cote s'il etait protege par un \, pour que
+	le decoupage sur IFS l'ignore.
+*/
+int	push_read_char(t_read_line *line, char c, int is_escaped)
+{
+	size_t	capacity;
+	char	*buffer;
+	char	*escaped;
+
+	if (line->len >= line->capacity)
+	{
+		capacity = READ_LINE_MIN_CAPACITY;
+		if (line->capacity)
+			capacity = line->capacity * 2;
+		buffer = realloc(line->buffer, capacity);
+		if (buffer)
+			line->buffer = buffer;
+		escaped = realloc(line->is_escaped, capacity);
+		if (escaped)
+			line->is_escaped = escaped;
+		if (!buffer || !escaped)
+			return (FALSE);
+		line->capacity = capacity;
+	}
+	line->buffer[line->len] = c;
+	line->is_escaped[line->len++] = is_escaped;
+	return (TRUE);
+}
+
+/*
+	Sans -r, \ protege le caractere suivant et \<newline> prolonge la
+	ligne. Renvoie la position du '\n' final, ou -1 s'il n'y est pas.
+*/
+ssize_t	process_read_chunk(t_read_line *line, const char *chunk, ssize_t n)
+{
+	ssize_t	i;
+
+	i = ZERO_INIT;
+	while (i < n)
+	{
+		if (line->has_backslash)
+		{
+			line->has_backslash = FALSE;
+			if (chunk[i] != '\n')
+				push_read_char(line, chunk[i], TRUE);
+		}
+		else if (!line->is_raw && chunk[i] == '\\')
+			line->has_backslash = TRUE;
+		else if (chunk[i] == '\n')
+			return (i);
+		else
+			push_read_char(line, chunk[i], FALSE);
+		i++;
+	}
+	return (-1);
+}
+
+/*
+	Renvoie TRUE si une ligne complete a ete lue, FALSE a la fin de
+	l'entree (ce qui a ete lu reste dans line).
+*/
+int	read_builtin_line(t_read_line *line)
+{
+	char	chunk[READ_CHUNK_SIZE];
+	ssize_t	size;
+	ssize_t	n;
+	ssize_t	end;
+
+	size = 1;
+	if (line->is_seekable)
+		size = READ_CHUNK_SIZE;
+	n = read(line->fd, chunk, size);
+	while (n > 0)
+	{
+		end = process_read_chunk(line, chunk, n);
+		if (end >= 0)
+		{
+			if (end + 1 < n)
+				lseek(line->fd, end + 1 - n, SEEK_CUR);
+			return (TRUE);
+		}
+		n = read(line->fd, chunk, size);
+	}
+	return (FALSE);
+}
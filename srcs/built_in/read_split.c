@@ -0,0 +1,58 @@
+#include "../../include/minishell.h"
+
+size_t	skip_read_ifs_spaces(t_read_line *line, const char *ifs, size_t pos)
+{
+	while (pos < line->len && is_read_ifs_space(line, ifs, pos))
+		pos++;
+	return (pos);
+}
+
+size_t	find_read_field_end(t_read_line *line, const char *ifs, size_t pos)
+{
+	while (pos < line->len && !is_read_ifs(line, ifs, pos))
+		pos++;
+	return (pos);
+}
+
+/*
+	Un delimiteur est une suite de blancs d'IFS, avec au plus un autre
+	caractere d'IFS au milieu.
+*/
+size_t	skip_read_delimiter(t_read_line *line, const char *ifs, size_t pos)
+{
+	pos = skip_read_ifs_spaces(line, ifs, pos);
+	if (pos < line->len && is_read_ifs(line, ifs, pos))
+		pos++;
+	return (skip_read_ifs_spaces(line, ifs, pos));
+}
+
+/*
+	Un champ par nom, le dernier nom recoit le reste de la ligne sans les
+	blancs d'IFS de fin. Sans nom, REPLY recoit la ligne telle quelle.
+*/
+void	assign_read_fields(t_data *data, t_read_line *line, char **names)
+{
+	char	*ifs;
+	size_t	pos;
+	size_t	end;
+
+	if (!names[0])
+	{
+		assign_read_var(data, READ_DEFAULT_VAR, line->buffer, line->len);
+		return ;
+	}
+	ifs = get_env_var_value(data, ENV_IFS);
+	if (!ifs)
+		ifs = DEFAULT_IFS;
+	pos = skip_read_ifs_spaces(line, ifs, 0);
+	while (names[1])
+	{
+		end = find_read_field_end(line, ifs, pos);
+		assign_read_var(data, *names++, line->buffer + pos, end - pos);
+		pos = skip_read_delimiter(line, ifs, end);
+	}
+	end = line->len;
+	while (end > pos && is_read_ifs_space(line, ifs, end - 1))
+		end--;
+	assign_read_var(data, names[0], line->buffer + pos, end - pos);
+}
@@ -0,0 +1,82 @@
+#include "../../include/minishell.h"
+
+void	write_stat_number(t_outbuf *out, unsigned long nb)
+{
+	char	digits[24];
+	int		i;
+
+	i = sizeof(digits);
+	digits[--i] = '\0';
+	if (nb == 0)
+		digits[--i] = '0';
+	while (nb)
+	{
+		digits[--i] = '0' + nb % 10;
+		nb /= 10;
+	}
+	puts_outbuf(out, digits + i);
+}
+
+char	*get_stat_name(int id)
+{
+	if (id == STAT_FORK)
+		return ("fork");
+	if (id == STAT_PIPE)
+		return ("pipe");
+	if (id == STAT_DUP2)
+		return ("dup2");
+	if (id == STAT_OPEN)
+		return ("open");
+	if (id == STAT_ACCESS)
+		return ("access");
+	if (id == STAT_WRITE)
+		return ("write");
+	return ("alloc");
+}
+
+/*
+	Une ligne par periode, "nom valeur" separes par des espaces, pour
+	rester facile a filtrer avec grep ou awk.
+*/
+void	write_shellstat_row(t_outbuf *out, char *label, unsigned long *nb)
+{
+	int	id;
+
+	puts_outbuf(out, label);
+	id = ZERO_INIT;
+	while (id < STAT_NB)
+	{
+		write_outbuf(out, " ", 1);
+		puts_outbuf(out, get_stat_name(id));
+		write_outbuf(out, " ", 1);
+		write_stat_number(out, nb[id]);
+		id++;
+	}
+	write_outbuf(out, "\n", 1);
+}
+
+/*
+	Affiche les appels systeme de la derniere ligne terminee, puis le
+	cumul depuis le lancement du shell (enfants compris). alloc compte
+	les malloc_track.
+*/
+void	ft_shellstat(t_data *data)
+{
+	t_shellstat	*stats;
+	t_outbuf	*out;
+
+	stats = get_shell_stats(NULL);
+	if (!stats)
+	{
+		ft_dprintf(STDERR_FILENO, "shellstat: counters unavailable\n");
+		g_globi = 1;
+		return ;
+	}
+	out = start_builtin_output(data);
+	g_globi = 0;
+	if (!out)
+		return ;
+	write_shellstat_row(out, "last", stats->last_line);
+	write_shellstat_row(out, "total", stats->total);
+	finish_builtin_output(data);
+}
@@ -0,0 +1,69 @@
+#include "../../include/minishell.h"
+
+/*
+	Une seule erreur est affichee par appel ; le code de retour passe a
+	TEST_ERROR (2), comme dans bash.
+*/
+void	report_test_error(t_test *test, char *arg, char *msg)
+{
+	if (test->status == TEST_ERROR)
+		return ;
+	if (arg)
+		ft_dprintf(STDERR_FILENO, "minishell: %s: %s: %s\n", \
+		test->name, arg, msg);
+	else
+		ft_dprintf(STDERR_FILENO, "minishell: %s: %s\n", test->name, msg);
+	test->status = TEST_ERROR;
+}
+
+/*
+	[ exige un ] comme dernier argument, qui ne fait pas partie de
+	l'expression
+*/
+int	init_test(t_test *test, char **argv, int argc)
+{
+	test->name = argv[0];
+	test->argv = argv + 1;
+	test->argc = argc - 1;
+	test->pos = ZERO_INIT;
+	test->status = TEST_TRUE;
+	if (strcmp(argv[0], CMD_BRACKET))
+		return (TRUE);
+	if (argc < 2 || strcmp(argv[argc - 1], "]"))
+	{
+		report_test_error(test, NULL, "missing `]'");
+		return (FALSE);
+	}
+	test->argc--;
+	return (TRUE);
+}
+
+/*
+	test et [ : evaluent l'expression dans le shell, sans fork ni
+	recherche dans le PATH. 0 si vraie, 1 si fausse, 2 en cas d'erreur.
+*/
+void	ft_test(t_lexer *lexer_lst, t_data *data)
+{
+	t_test	test;
+	char	**argv;
+	int		argc;
+	int		result;
+
+	argv = collect_builtin_args(lexer_lst, data, &argc);
+	if (!argv || !init_test(&test, argv, argc))
+	{
+		g_globi = TEST_ERROR;
+		return ;
+	}
+	result = FALSE;
+	if (test.argc > 0)
+		result = eval_test_or(&test);
+	if (test.pos < test.argc)
+		report_test_error(&test, NULL, "too many arguments");
+	if (test.status == TEST_ERROR)
+		g_globi = TEST_ERROR;
+	else if (result)
+		g_globi = TEST_TRUE;
+	else
+		g_globi = TEST_FALSE;
+}
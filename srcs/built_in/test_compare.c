@@ -0,0 +1,75 @@
+#include "../../include/minishell.h"
+
+int	eval_test_unary(char op, char *arg)
+{
+	struct stat	st;
+
+	if (op == 'n')
+		return (arg[0] != '\0');
+	if (op == 'z')
+		return (arg[0] == '\0');
+	if (op == 't')
+		return (isatty(atoi(arg)));
+	if (op == 'L' || op == 'h')
+		return (lstat(arg, &st) == 0 && S_ISLNK(st.st_mode));
+	if (op == 'r')
+		return (ft_access(arg, R_OK) == 0);
+	if (op == 'w')
+		return (ft_access(arg, W_OK) == 0);
+	if (op == 'x')
+		return (ft_access(arg, X_OK) == 0);
+	return (stat(arg, &st) == 0 && is_test_file_type(op, &st));
+}
+
+/*
+	Entier decimal signe, espaces autour toleres ; sinon erreur.
+*/
+int	parse_test_integer(t_test *test, char *arg, long long *value)
+{
+	char	*end;
+
+	errno = 0;
+	*value = strtoll(arg, &end, 10);
+	while (end != arg && (*end == ' ' || *end == '\t'))
+		end++;
+	if (end == arg || *end || errno == ERANGE)
+	{
+		report_test_error(test, arg, "integer expression expected");
+		return (FALSE);
+	}
+	return (TRUE);
+}
+
+int	compare_test_integers(char *op, long long left, long long right)
+{
+	if (!strcmp(op, "-eq"))
+		return (left == right);
+	if (!strcmp(op, "-ne"))
+		return (left != right);
+	if (!strcmp(op, "-lt"))
+		return (left < right);
+	if (!strcmp(op, "-le"))
+		return (left <= right);
+	if (!strcmp(op, "-gt"))
+		return (left > right);
+	return (left >= right);
+}
+
+int	eval_test_binary(t_test *test, char *left, char *op, char *right)
+{
+	long long	left_nb;
+	long long	right_nb;
+
+	if (!strcmp(op, "=") || !strcmp(op, "=="))
+		return (!strcmp(left, right));
+	if (!strcmp(op, "!="))
+		return (strcmp(left, right) != 0);
+	if (!strcmp(op, "<"))
+		return (strcmp(left, right) < 0);
+	if (!strcmp(op, ">"))
+		return (strcmp(left, right) > 0);
+	if (!parse_test_integer(test, left, &left_nb) \
+	|| !parse_test_integer(test, right, &right_nb))
+		return (FALSE);
+	return (compare_test_integers(op, left_nb, right_nb));
+}
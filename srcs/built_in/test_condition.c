@@ -0,0 +1,48 @@
+#include "../../include/minishell.h"
+
+bool	is_test_word(t_test *test, int pos, char *word)
+{
+	return (!strcmp(test->argv[pos], word));
+}
+
+bool	is_test_unary_op(char *arg)
+{
+	return (arg[0] == '-' && arg[1] && !arg[2] \
+	&& ft_strchr("bcdefghLnprsStuwxz", arg[1]));
+}
+
+bool	is_test_binary_op(char *arg)
+{
+	return (!strcmp(arg, "=") || !strcmp(arg, "==") || !strcmp(arg, "!=") \
+	|| !strcmp(arg, "<") || !strcmp(arg, ">") || !strcmp(arg, "-eq") \
+	|| !strcmp(arg, "-ne") || !strcmp(arg, "-lt") || !strcmp(arg, "-le") \
+	|| !strcmp(arg, "-gt") || !strcmp(arg, "-ge"));
+}
+
+bool	is_binary_test_at(t_test *test, int pos)
+{
+	return (pos + 2 < test->argc && is_test_binary_op(test->argv[pos + 1]));
+}
+
+bool	is_test_file_type(char op, struct stat *st)
+{
+	if (op == 'f')
+		return (S_ISREG(st->st_mode));
+	if (op == 'd')
+		return (S_ISDIR(st->st_mode));
+	if (op == 's')
+		return (st->st_size > 0);
+	if (op == 'b')
+		return (S_ISBLK(st->st_mode));
+	if (op == 'c')
+		return (S_ISCHR(st->st_mode));
+	if (op == 'p')
+		return (S_ISFIFO(st->st_mode));
+	if (op == 'S')
+		return (S_ISSOCK(st->st_mode));
+	if (op == 'g')
+		return ((st->st_mode & S_ISGID) != 0);
+	if (op == 'u')
+		return ((st->st_mode & S_ISUID) != 0);
+	return (op == 'e');
+}
@@ -0,0 +1,90 @@
+#include "../../include/minishell.h"
+
+/*
+	Descente recursive : -o lie moins fort que -a, qui lie moins fort que
+	!. Une operation binaire est reconnue avant tout le reste quand elle
+	est en deuxieme position, pour que [ ! = x ] ou [ -n = -n ] se lisent
+	comme bash les lit.
+*/
+int	eval_test_or(t_test *test)
+{
+	int	result;
+
+	result = eval_test_and(test);
+	while (test->pos < test->argc && is_test_word(test, test->pos, "-o"))
+	{
+		test->pos++;
+		if (eval_test_and(test))
+			result = TRUE;
+	}
+	return (result);
+}
+
+int	eval_test_and(t_test *test)
+{
+	int	result;
+
+	result = eval_test_not(test);
+	while (test->pos < test->argc && is_test_word(test, test->pos, "-a"))
+	{
+		test->pos++;
+		if (!eval_test_not(test))
+			result = FALSE;
+	}
+	return (result);
+}
+
+int	eval_test_not(t_test *test)
+{
+	if (test->pos + 1 < test->argc && is_test_word(test, test->pos, "!") \
+	&& !is_binary_test_at(test, test->pos))
+	{
+		test->pos++;
+		return (!eval_test_not(test));
+	}
+	return (eval_test_primary(test));
+}
+
+int	eval_test_group(t_test *test)
+{
+	int	result;
+
+	test->pos++;
+	result = eval_test_or(test);
+	if (test->pos >= test->argc || !is_test_word(test, test->pos, ")"))
+	{
+		report_test_error(test, NULL, "`)' expected");
+		return (FALSE);
+	}
+	test->pos++;
+	return (result);
+}
+
+int	eval_test_primary(t_test *test)
+{
+	char	**argv;
+	int		pos;
+
+	argv = test->argv;
+	pos = test->pos;
+	if (pos >= test->argc)
+	{
+		report_test_error(test, NULL, "argument expected");
+		return (FALSE);
+	}
+	if (is_binary_test_at(test, pos))
+	{
+		test->pos += 3;
+		return (eval_test_binary(test, argv[pos], argv[pos + 1], \
+		argv[pos + 2]));
+	}
+	if (pos + 1 < test->argc && is_test_word(test, pos, "("))
+		return (eval_test_group(test));
+	if (pos + 1 < test->argc && is_test_unary_op(argv[pos]))
+	{
+		test->pos += 2;
+		return (eval_test_unary(argv[pos][1], argv[pos + 1]));
+	}
+	test->pos++;
+	return (argv[pos][0] != '\0');
+}
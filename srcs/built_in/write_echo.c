@@ -1,53 +1,38 @@
 #include "../../include/minishell.h"
 
 /*
-	ecri dans la sortie les argument apres verif qu'il soit pas un -n puis
-	ecrit un espace entre les argumen ,elle est utiliser quand echo doit etre
-	afficher ailleurs que dans la sorti standard
+	ecri dans le tampon de sortie les argument apres verif qu'il soit pas
+	un -n puis ecrit un espace entre les argument, elle est utiliser quand
+	echo a recu l'option -n
 */
-void	write_echo_fd(char **tab, int i, t_data *data)
+void	write_echo_words_skipping_n(char **tab, int i, t_outbuf *out)
 {
 	while (tab[i])
 	{
 		if (ft_strcmp(tab[i], "-n"))
 		{
-			ft_write_fd(tab[i], data->utils->node->output_fd);
+			puts_outbuf(out, tab[i]);
 			if (tab[i + 1])
-				ft_write_fd(" ", data->utils->node->output_fd);
+				write_outbuf(out, " ", 1);
 		}
 		i++;
 	}
 }
 
 /*
-	elle est apeller dans process_echo si il y a besoin d'use une sorti special
-	si j n'est pas nul la fonction va ecrire un space pour separer les argument
-	et n'ecrit rien si j est nul
-	procc_in_echo_fd ecrit les argument de echo si il y a besoin d'une
-	redirection
+	ecrit chaque argument de echo dans le tampon de sortie en les separant
+	par un espace, sans rien ajouter avant le premier
 */
-int	procc_in_echo_fd(char **tab, int i, int j, t_data *data)
+void	write_echo_words(char **tab, int i, t_outbuf *out)
 {
+	int	j;
+
+	j = ZERO_INIT;
 	while (tab[i])
 	{
 		if (j)
-		{
-			if (ft_write_fd(" ", data->utils->node->output_fd))
-			{
-				g_globi = 1;
-				return (-1);
-			}
-			ft_write_fd(tab[i++], data->utils->node->output_fd);
-		}
-		else
-		{
-			if (ft_write_fd(tab[i++], data->utils->node->output_fd))
-			{
-				g_globi = 1;
-				return (-1);
-			}
-			j++;
-		}
+			write_outbuf(out, " ", 1);
+		puts_outbuf(out, tab[i++]);
+		j++;
 	}
-	return (0);
 }
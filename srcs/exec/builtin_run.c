@@ -0,0 +1,28 @@
+#include "../../include/minishell.h"
+
+/*
+	Adaptateurs vers la signature commune de la table des builtins.
+*/
+void	run_echo(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	init_echo(lexer_lst, data);
+}
+
+void	run_cd(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	get_cd(lexer_lst, data);
+}
+
+void	run_pwd(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	get_pwd(lexer_lst->cmd_segment, data);
+}
+
+void	run_export(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	export_things(lexer_lst, data);
+}
@@ -0,0 +1,34 @@
+#include "../../include/minishell.h"
+
+/*
+	env et unset passent tous deux par get_unset, qui les distingue.
+*/
+void	run_unset(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	get_unset(lexer_lst, data);
+}
+
+void	run_exit(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	ft_exit(lexer_lst, fd, data);
+}
+
+void	run_shellstat(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)lexer_lst;
+	(void)fd;
+	ft_shellstat(data);
+}
+
+void	run_test(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	ft_test(lexer_lst, data);
+}
+
+void	run_printf(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	ft_printf_builtin(lexer_lst, data);
+}
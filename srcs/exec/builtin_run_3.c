@@ -0,0 +1,25 @@
+#include "../../include/minishell.h"
+
+void	run_true(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)lexer_lst;
+	(void)fd;
+	(void)data;
+	g_globi = 0;
+}
+
+void	run_false(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)lexer_lst;
+	(void)fd;
+	(void)data;
+	g_globi = 1;
+}
+
+void	run_read(t_lexer *lexer_lst, int *fd, t_data *data)
+{
+	(void)fd;
+	release_unread_input(data);
+	ft_read(lexer_lst, data);
+	reclaim_unread_input(data);
+}
@@ -0,0 +1,93 @@
+#include "../../include/minishell.h"
+
+/*
+	Table des builtins indexee par leur id (BUILTIN_ECHO...). La case 0
+	(BUILTIN_NONE) reste vide.
+*/
+const t_builtin	*get_builtin_table(void)
+{
+	static const t_builtin	table[BUILTIN_NB] = {
+	{NULL, NULL},
+	{CMD_ECHO, run_echo},
+	{CMD_CHANG_DIRCT, run_cd},
+	{CMD_PRINT_DIRCT, run_pwd},
+	{CMD_EXPORT_VARS, run_export},
+	{CMD_UNSET_VARS, run_unset},
+	{CMD_ENV_VARS, run_unset},
+	{CMD_EXIT_SHELL, run_exit},
+	{CMD_SHELLSTAT, run_shellstat},
+	{CMD_TEST, run_test},
+	{CMD_BRACKET, run_test},
+	{CMD_PRINTF, run_printf},
+	{CMD_TRUE, run_true},
+	{CMD_FALSE, run_false},
+	{CMD_READ, run_read}};
+
+	return (table);
+}
+
+/*
+	Hash parfait des noms de builtins : premiere et derniere lettre plus
+	la longueur, sur BUILTIN_HASH_SIZE cases. Les multiplicateurs ont ete
+	choisis hors ligne pour que tous les noms tombent dans une case
+	differente ; il faut les rechoisir si on ajoute un builtin.
+*/
+int	hash_builtin_name(const char *name, size_t len)
+{
+	return ((BUILTIN_HASH_FIRST_MULT * (unsigned char)name[0] \
+	+ BUILTIN_HASH_LAST_MULT * (unsigned char)name[len - 1] + len) \
+	& (BUILTIN_HASH_SIZE - 1));
+}
+
+/*
+	Un hash puis un seul strcmp pour savoir si name est un builtin.
+*/
+int	find_builtin_id(const char *name)
+{
+	static const int	slot_to_id[BUILTIN_HASH_SIZE] = {
+		BUILTIN_BRACKET, 0, 0, BUILTIN_PWD, 0, 0, BUILTIN_READ,
+		BUILTIN_FALSE, BUILTIN_TEST, 0, BUILTIN_UNSET, 0, BUILTIN_SHELLSTAT,
+		0, 0, 0, BUILTIN_ENV, 0, 0, 0, BUILTIN_TRUE, BUILTIN_CD, 0, 0, 0,
+		BUILTIN_EXIT, 0, BUILTIN_EXPORT, 0, BUILTIN_ECHO, BUILTIN_PRINTF, 0};
+	size_t				len;
+	int					id;
+
+	if (!name)
+		return (BUILTIN_NONE);
+	len = strlen(name);
+	if (!len)
+		return (BUILTIN_NONE);
+	id = slot_to_id[hash_builtin_name(name, len)];
+	if (id == BUILTIN_NONE || strcmp(get_builtin_table()[id].name, name))
+		return (BUILTIN_NONE);
+	return (id);
+}
+
+/*
+	Id de builtin du lexeme, resolu une seule fois : le lexer l'a deja
+	pose pour les mots nus, les autres sont resolus ici apres expansion
+	et retrait des quotes.
+*/
+int	get_builtin_id(t_lexer *lexer_lst)
+{
+	if (lexer_lst->builtin_id == BUILTIN_UNRESOLVED)
+		lexer_lst->builtin_id = find_builtin_id(lexer_lst->cmd_segment);
+	return (lexer_lst->builtin_id);
+}
+
+/*
+	Appele a la creation du lexeme : un mot fait uniquement de minuscules
+	ne sera modifie ni par l'expansion ni par le retrait des quotes ou
+	des parentheses, son id peut donc etre fixe tout de suite.
+*/
+int	tag_builtin_id(const char *word)
+{
+	size_t	i;
+
+	i = ZERO_INIT;
+	while (word[i] >= 'a' && word[i] <= 'z')
+		i++;
+	if (word[i])
+		return (BUILTIN_UNRESOLVED);
+	return (find_builtin_id(word));
+}
@@ -76,13 +76,30 @@ t_data *data, int *fd, int count, t_exec utils)
 {
 	pid_t	pid;
 
-	pid = fork();
+	release_unread_input(data);
+	pid = ft_fork();
 	if (pid < 0)
 	{
 		perror("Fork");
 		return (FT_FAILURE_EXIT);
 	}
 	if (pid == CHILD_PROCESS)
+	{
+		drop_unread_input(data);
 		exec_cmd_with_redirection_and_builtins(data, fd, count, utils);
+	}
 	return (pid);
 }
+
+/*
+	Derniere commande d'un script ou d'une chaine -c : il ne reste rien
+	a executer apres elle, le shell se remplace donc par la commande
+	(execve sans fork ni wait). Le code de sortie est directement celui
+	de la commande. stdout est vide avant, execve perdant le tampon.
+*/
+void	exec_tail_cmd_in_place_of_shell(t_data *data, int *fd, int count)
+{
+	fflush(stdout);
+	release_unread_input(data);
+	exec_cmd_with_redirection_and_builtins(data, fd, count, *(data->utils));
+}
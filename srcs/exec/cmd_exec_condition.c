@@ -2,7 +2,7 @@
 
 bool	is_pipe_creation_failed(int *fd, int total_number_of_cmd)
 {
-	return (total_number_of_cmd >= 1 && pipe(fd) < 0);
+	return (total_number_of_cmd >= 1 && ft_pipe(fd, 0) < 0);
 }
 
 bool	is_single_command_in_list(t_data *data)
@@ -15,3 +15,18 @@ bool	is_single_builtin_command(t_data *data)
 	return (\
 	is_built_in_command(data->lexer_list) && is_single_command_in_list(data));
 }
+
+bool	is_last_stage_builtin_for_parent(t_data *data, int count)
+{
+	return (count == data->utils->nb_cmd_in_lst - 1 \
+	&& is_built_in_command(data->lexer_list) \
+	&& get_builtin_id(data->lexer_list) != BUILTIN_EXIT);
+}
+
+bool	is_tail_exec_possible(t_data *data)
+{
+	return (data->is_tail_exec_allowed \
+	&& is_single_command_in_list(data) \
+	&& !is_built_in_command(data->lexer_list) \
+	&& !is_pipeline_timed(data));
+}
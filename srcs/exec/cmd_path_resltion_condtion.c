@@ -9,5 +9,5 @@ bool	is_env_var_path_name(t_env *env)
 
 bool	is_invalid_direct_path(const char *cmd)
 {
-	return (access(cmd, X_OK) && *cmd == '/');
+	return (ft_access(cmd, X_OK) && *cmd == '/');
 }
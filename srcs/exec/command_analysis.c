@@ -1,30 +1,8 @@
 #include "../../include/minishell.h"
 
-int	is_cmd_match(\
-t_lexer *lexer_lst, const char *command, int command_length)
-{
-	return (!ft_strncmp(lexer_lst->cmd_segment, command, command_length) \
-	&& strlen2(lexer_lst->cmd_segment) == command_length);
-}
-
 int	is_built_in_command(t_lexer *lexer_lst)
 {
-	if (lexer_lst->cmd_segment == NULL)
-		return (0);
-	return (is_cmd_match(\
-	lexer_lst, CMD_PRINT_DIRCT, ft_strlen(CMD_PRINT_DIRCT)) \
-	|| is_cmd_match(\
-	lexer_lst, CMD_ECHO, ft_strlen(CMD_ECHO)) \
-	|| is_cmd_match(\
-	lexer_lst, CMD_ENV_VARS, ft_strlen(CMD_ENV_VARS)) \
-	|| is_cmd_match(\
-	lexer_lst, CMD_UNSET_VARS, ft_strlen(CMD_UNSET_VARS)) \
-	|| is_cmd_match(\
-	lexer_lst, CMD_CHANG_DIRCT, ft_strlen(CMD_CHANG_DIRCT)) \
-	|| is_cmd_match(\
-	lexer_lst, CMD_EXPORT_VARS, ft_strlen(CMD_EXPORT_VARS)) \
-	|| is_cmd_match(\
-	lexer_lst, CMD_EXIT_SHELL, ft_strlen(CMD_EXIT_SHELL)));
+	return (get_builtin_id(lexer_lst) != BUILTIN_NONE);
 }
 
 int	should_continue_execution(t_data *data, int *y)
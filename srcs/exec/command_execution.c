@@ -1,24 +1,16 @@
 #include "../../include/minishell.h"
 
 /*
-	execute les built_in
+	execute les built_in via la table, a partir de l'id resolu une fois
+	sur le lexeme de la commande.
 */
 void	ft_exec_single_built_in(t_lexer *lexer_lst, int *fd, t_data *data)
 {
-	if (is_cmd_match(lexer_lst, CMD_EXPORT_VARS, strlen(CMD_EXPORT_VARS)))
-		export_things(lexer_lst, data);
-	else if (is_cmd_match(lexer_lst, CMD_PRINT_DIRCT, strlen(CMD_PRINT_DIRCT)))
-		get_pwd(lexer_lst->cmd_segment, data);
-	else if (is_cmd_match(lexer_lst, CMD_ECHO, strlen(CMD_ECHO)))
-		init_echo(lexer_lst, data);
-	else if (is_cmd_match(lexer_lst, CMD_CHANG_DIRCT, strlen(CMD_CHANG_DIRCT)))
-		get_cd(lexer_lst, data);
-	else if (is_cmd_match(lexer_lst, CMD_ENV_VARS, strlen(CMD_ENV_VARS)))
-		get_unset(lexer_lst, data);
-	else if (is_cmd_match(lexer_lst, CMD_UNSET_VARS, strlen(CMD_UNSET_VARS)))
-		get_unset(lexer_lst, data);
-	else if (is_cmd_match(lexer_lst, CMD_EXIT_SHELL, strlen(CMD_EXIT_SHELL)))
-		ft_exit(lexer_lst, fd, data);
+	int	id;
+
+	id = get_builtin_id(lexer_lst);
+	if (id != BUILTIN_NONE)
+		get_builtin_table()[id].run(lexer_lst, fd, data);
 	if (data->utils->node->output_fd > 0)
 		close(data->utils->node->output_fd);
 	lexer_lst = data->utils->head_lexer_lst;
@@ -38,6 +30,7 @@ void	close_fds_if_needed(int *fd, int previous_fd)
 int	manage_exec_linked_cmd_sequence(int *fd, pid_t *pid, t_data *data, int *y)
 {
 	data->lexer_list = data->utils->head_lexer_lst;
+	data->utils->is_last_stage_run_in_parent = FALSE;
 	while (should_continue_execution(data, y))
 	{
 		data->lexer_list = find_next_command_in_lexer(data->lexer_list);
@@ -46,13 +39,7 @@ int	manage_exec_linked_cmd_sequence(int *fd, pid_t *pid, t_data *data, int *y)
 		fd, data->utils->nb_cmd_in_lst))
 			return (0);
 		if (check_redirection_validity_in_node(data->utils->node))
-		{
-			if (is_single_builtin_command(data))
-				ft_exec_single_built_in(data->lexer_list, fd, data);
-			else
-				pid[y[0]++] = create_and_execute_child_process(\
-				data, fd, y[1], *(data->utils));
-		}
+			exec_pipeline_stage(data, fd, pid, y);
 		data->lexer_list = reaches_next_cmd_preceded_by_pipe(data->lexer_list);
 		close_fds_if_needed(fd, data->utils->previous_fd);
 		data->utils->node = data->utils->node->next;
@@ -61,9 +48,37 @@ int	manage_exec_linked_cmd_sequence(int *fd, pid_t *pid, t_data *data, int *y)
 	return (1);
 }
 
+/*
+	Attend chaque enfant lance, dans l'ordre du pipeline, et met a jour
+	le code de retour avec celui de la derniere commande (celle du
+	builtin execute dans le parent le cas echeant).
+*/
+void	wait_and_process_child_statuses(\
+pid_t *pid, int *wstatus, int nb_node, t_data *data)
+{
+	int	index;
+
+	index = ZERO_INIT;
+	while (should_continue_waiting_for_child_processes(nb_node--, data))
+	{
+		if (pid && pid[index])
+		{
+			wait_child_process(pid[index], wstatus, data, index);
+			index++;
+		}
+		if (WIFEXITED(*wstatus))
+			g_globi = WEXITSTATUS(*wstatus);
+	}
+	if (data->utils->is_last_stage_run_in_parent)
+		g_globi = data->utils->last_stage_status;
+	close_file_descriptors_in_linked_list(data);
+}
+
 /*
 	Prépare et exécute les commandes, gère les processus enfants
-	et ferme les descripteurs de fichier ouverts
+	et ferme les descripteurs de fichier ouverts.
+	Si la ligne commence par "time", le rapport est ecrit une fois
+	tous les enfants attendus.
 */
 void	manage_execution_resources(t_data *data)
 {
@@ -77,19 +92,14 @@ void	manage_execution_resources(t_data *data)
 	if (!pid)
 		return ;
 	initialize_pid_array_to_zero(pid, data->utils->cmd_nb_pipe);
+	start_time_report(data);
 	handle_process_signal();
 	if (!manage_exec_linked_cmd_sequence(fd, pid, data, y))
 		perror("Pipe ");
-	if (!is_process_pid_valid_for_wait(*pid))
-		return ;
-	y[0] = 0;
-	while (--data->utils->cmd_nb_pipe >= 0 && \
-	data->utils->heredoc_ctrl_c_uninterrupted && data->utils->nb_cmd_in_lst)
-	{
-		if (pid && pid[y[0]])
-			waitpid(pid[y[0]++], &wstatus, 0);
-		if (WIFEXITED(wstatus))
-			g_globi = WEXITSTATUS(wstatus);
-	}
-	close_file_descriptors_in_linked_list(data);
+	mark_trace_phase(data, TRACE_LAUNCH);
+	if (is_process_pid_valid_for_wait(*pid))
+		wait_and_process_child_statuses(\
+		pid, &wstatus, data->utils->cmd_nb_pipe, data);
+	mark_trace_phase(data, TRACE_WAIT);
+	print_time_report(data);
 }
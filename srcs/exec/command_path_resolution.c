@@ -45,7 +45,7 @@ char	*find_command_full_path(char *cmd, t_env *env_lst, t_data *data)
 		{
 			tmp = ft_strjoin2_mini(path[index], "/", data);
 			tmp = ft_strjoin2_mini(tmp, cmd, data);
-			if (!access(tmp, F_OK))
+			if (!ft_access(tmp, F_OK))
 				return (tmp);
 			index++;
 		}
@@ -63,8 +63,9 @@ t_lexer *lexer, t_exec utils, t_data *data)
 	if (!find_command_full_path(\
 	lexer->cmd_segment, utils.linked_list_full_env_var_copy_alpha, data))
 	{
-		write(STDERR_FILENO, lexer->cmd_segment, strlen2(lexer->cmd_segment));
-		write(\
+		ft_write(\
+		STDERR_FILENO, lexer->cmd_segment, strlen2(lexer->cmd_segment));
+		ft_write(\
 		STDERR_FILENO, ERR_MSG_CMD_NOT_FOUND, \
 		ft_strlen(ERR_MSG_CMD_NOT_FOUND));
 		return (EXIT_FAIL);
@@ -7,7 +7,7 @@ bool	is_cmd_empty_or_null(char *cmd)
 
 bool	is_cmd_executable(char *command)
 {
-	return (access(command, X_OK) == 0);
+	return (ft_access(command, X_OK) == 0);
 }
 
 bool	is_lexer_token_cmd_arg(t_lexer *lexer_item)
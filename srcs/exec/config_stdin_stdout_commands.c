@@ -17,7 +17,7 @@ void	configure_stdin_redirection_for_command(t_exec utils, int count)
 {
 	if (is_fd_set_for_redirection(utils.node->input_fd))
 	{
-		dup2(utils.node->input_fd, STDIN_FILENO);
+		ft_dup2(utils.node->input_fd, STDIN_FILENO);
 		if (is_fd_valid_for_close(utils.node->input_fd))
 			close(utils.node->input_fd);
 		if (utils.previous_fd)
@@ -25,7 +25,7 @@ void	configure_stdin_redirection_for_command(t_exec utils, int count)
 	}
 	else if (count)
 	{
-		dup2(utils.previous_fd, STDIN_FILENO);
+		ft_dup2(utils.previous_fd, STDIN_FILENO);
 		if (is_fd_valid_for_close(utils.previous_fd))
 			close(utils.previous_fd);
 	}
@@ -44,13 +44,13 @@ t_exec utils, int *fd, int count)
 {
 	if (is_fd_valid_for_close(utils.node->output_fd))
 	{
-		dup2(utils.node->output_fd, STDOUT_FILENO);
+		ft_dup2(utils.node->output_fd, STDOUT_FILENO);
 		if (is_fd_valid_for_close(utils.node->input_fd))
 			close (utils.node->input_fd);
 	}
 	else if (is_not_last_command_and_fd_open(\
 	count, utils.nb_cmd_in_lst, fd[1]))
-		dup2(fd[1], STDOUT_FILENO);
+		ft_dup2(fd[1], STDOUT_FILENO);
 	if (is_fd_valid_for_close(fd[1]))
 		close(fd[1]);
 	if (is_fd_valid_for_close(fd[0]))
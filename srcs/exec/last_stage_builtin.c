@@ -0,0 +1,31 @@
+#include "../../include/minishell.h"
+
+/*
+	Execute dans le parent le builtin qui termine un pipeline, comme
+	l'option lastpipe de bash : pas de fork, et ses effets (cd, export,
+	unset) restent visibles pour les commandes suivantes.
+	L'entree standard est branchee temporairement sur le pipe precedent
+	(ou le here_doc), puis restauree. La sortie d'un dernier etage est
+	deja le terminal ou node->output_fd, il n'y a rien a rediriger.
+*/
+void	exec_last_stage_builtin_in_parent(t_data *data, int *fd, int count)
+{
+	int	saved_stdin;
+
+	saved_stdin = dup(STDIN_FILENO);
+	if (saved_stdin < 0)
+	{
+		perror("dup");
+		return ;
+	}
+	configure_stdin_redirection_for_command(*(data->utils), count);
+	data->utils->previous_fd = FAIL;
+	if (is_fd_set_for_redirection(data->utils->node->input_fd))
+		data->utils->node->input_fd = INPUT_FD_NOT_SET;
+	ft_exec_single_built_in(data->lexer_list, fd, data);
+	fflush(stdout);
+	ft_dup2(saved_stdin, STDIN_FILENO);
+	close(saved_stdin);
+	data->utils->is_last_stage_run_in_parent = TRUE;
+	data->utils->last_stage_status = g_globi;
+}
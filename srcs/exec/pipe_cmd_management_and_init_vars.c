@@ -37,3 +37,24 @@ void	init_fd_and_status_vars(int *fd, int *y, int *wstatus)
 	fd[0] = ZERO_INIT;
 	fd[1] = ZERO_INIT;
 }
+
+/*
+	Lance une commande du pipeline : builtin seul, builtin en derniere
+	position execute dans le parent, commande finale a la place du shell,
+	ou enfant dont le pid est range dans 'pid'.
+*/
+void	exec_pipeline_stage(t_data *data, int *fd, pid_t *pid, int *y)
+{
+	if (is_single_builtin_command(data))
+		ft_exec_single_built_in(data->lexer_list, fd, data);
+	else if (is_last_stage_builtin_for_parent(data, y[1]))
+		exec_last_stage_builtin_in_parent(data, fd, y[1]);
+	else if (is_tail_exec_possible(data))
+		exec_tail_cmd_in_place_of_shell(data, fd, y[1]);
+	else
+	{
+		name_timed_stage(data, y[0]);
+		pid[y[0]++] = create_and_execute_child_process(\
+		data, fd, y[1], *(data->utils));
+	}
+}
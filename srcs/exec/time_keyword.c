@@ -0,0 +1,96 @@
+#include "../../include/minishell.h"
+
+/*
+	Apres le retrait du mot-cle "time", le premier segment peut ne plus
+	contenir de CMD (ex: "time > f ls" ou ls avait ete classe en ARG).
+	Promeut alors le premier ARG du segment en CMD.
+*/
+void	promote_first_argument_to_command(t_lexer *lexer)
+{
+	t_lexer	*first_arg;
+
+	first_arg = NULL;
+	while (lexer && lexer->token != PIPE)
+	{
+		if (lexer->token == CMD)
+			return ;
+		if (lexer->token == ARG && !first_arg)
+			first_arg = lexer;
+		lexer = lexer->next;
+	}
+	if (first_arg)
+		first_arg->token = CMD;
+}
+
+/*
+	Detecte le mot-cle "time" en tete de ligne, le retire de la liste du
+	lexer et arme le rapport de temps pour le pipeline qui suit.
+*/
+void	strip_time_keyword(t_data *data)
+{
+	t_lexer	*keyword;
+
+	data->utils->time_report.is_pipeline_timed = FALSE;
+	keyword = data->lexer_list;
+	if (!is_time_keyword(keyword))
+		return ;
+	data->utils->time_report.is_pipeline_timed = TRUE;
+	data->lexer_list = keyword->next;
+	data->lexer_list->prev = NULL;
+	promote_first_argument_to_command(data->lexer_list);
+}
+
+/*
+	Prend les mesures de depart (horloge monotone et rusage du shell) et
+	alloue un emplacement rusage et un nom par etape du pipeline.
+*/
+void	start_time_report(t_data *data)
+{
+	t_time_report	*report;
+	int				nb_stage;
+
+	report = &data->utils->time_report;
+	if (!is_pipeline_timed(data))
+		return ;
+	nb_stage = data->utils->cmd_nb_pipe;
+	report->nb_timed_stage = ZERO_INIT;
+	report->stage_usage = malloc_track(data, sizeof(struct rusage) * nb_stage);
+	report->stage_name = malloc_track(data, sizeof(char *) * nb_stage);
+	if (!report->stage_usage || !report->stage_name)
+	{
+		report->is_pipeline_timed = FALSE;
+		return ;
+	}
+	ft_memset(report->stage_usage, 0, sizeof(struct rusage) * nb_stage);
+	ft_memset(report->stage_name, 0, sizeof(char *) * nb_stage);
+	getrusage(RUSAGE_SELF, &report->shell_usage_start);
+	clock_gettime(CLOCK_MONOTONIC, &report->wall_start);
+}
+
+/*
+	Retient le nom de la commande lancee dans l'etape 'stage'.
+*/
+void	name_timed_stage(t_data *data, int stage)
+{
+	if (!is_pipeline_timed(data))
+		return ;
+	data->utils->time_report.stage_name[stage] = \
+	data->lexer_list->cmd_segment;
+}
+
+/*
+	Attend le processus 'pid' avec wait4 pour recuperer son rusage
+	quand le pipeline est chronometre.
+*/
+void	wait_child_process(pid_t pid, int *wstatus, t_data *data, int stage)
+{
+	struct rusage	*usage;
+
+	usage = NULL;
+	if (is_pipeline_timed(data))
+	{
+		usage = &data->utils->time_report.stage_usage[stage];
+		data->utils->time_report.nb_timed_stage = stage + 1;
+	}
+	wait4(pid, wstatus, 0, usage);
+}
@@ -0,0 +1,21 @@
+#include "../../include/minishell.h"
+
+bool	is_time_keyword(t_lexer *lexer)
+{
+	return (lexer && lexer->token == CMD \
+	&& !ft_strcmp(lexer->cmd_segment, TIME_KEYWORD) \
+	&& lexer->next && lexer->next->token != PIPE);
+}
+
+bool	is_pipeline_timed(t_data *data)
+{
+	return (data->utils->time_report.is_pipeline_timed == TRUE);
+}
+
+bool	is_json_time_format_requested(t_data *data)
+{
+	char	*format;
+
+	format = get_env_var_value(data, ENV_TIME_FORMAT);
+	return (format && !ft_strcmp(format, TIME_FORMAT_JSON));
+}
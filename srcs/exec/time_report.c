@@ -0,0 +1,91 @@
+#include "../../include/minishell.h"
+
+void	print_usec_as_seconds(char *label, long usec)
+{
+	ft_dprintf(STDERR_FILENO, "%s\t%ldm%ld.%03lds\n", label, \
+	usec / (USEC_PER_SEC * 60), (usec / USEC_PER_SEC) % 60, \
+	(usec / 1000) % 1000);
+}
+
+/*
+	Affiche une ligne par etape du pipeline : temps CPU, memoire
+	residente maximale et changements de contexte volontaires/forces.
+*/
+void	print_timed_stage_human(t_time_report *report, int stage)
+{
+	struct rusage	*usage;
+	char			*name;
+	long			user_ms;
+	long			sys_ms;
+
+	usage = &report->stage_usage[stage];
+	name = report->stage_name[stage];
+	if (!name)
+		name = "-";
+	user_ms = timeval_to_usec(usage->ru_utime) / 1000;
+	sys_ms = timeval_to_usec(usage->ru_stime) / 1000;
+	ft_dprintf(STDERR_FILENO, \
+	"[%d] %s\tuser %ld.%03lds\tsys %ld.%03lds\tmaxrss %ldkB\tcsw %ld/%ld\n", \
+	stage + 1, name, user_ms / 1000, user_ms % 1000, sys_ms / 1000, \
+	sys_ms % 1000, usage->ru_maxrss, usage->ru_nvcsw, usage->ru_nivcsw);
+}
+
+void	print_time_report_human(t_time_report *report, long *totals)
+{
+	int	stage;
+
+	ft_dprintf(STDERR_FILENO, "\n");
+	stage = -1;
+	while (++stage < report->nb_timed_stage)
+		print_timed_stage_human(report, stage);
+	print_usec_as_seconds("real", totals[TIME_REAL]);
+	print_usec_as_seconds("user", totals[TIME_USER]);
+	print_usec_as_seconds("sys", totals[TIME_SYS]);
+}
+
+/*
+	Rapport sur une seule ligne JSON, demande via MINISHELL_TIME_FORMAT=json.
+*/
+void	print_time_report_json(t_time_report *report, long *totals, \
+t_data *data)
+{
+	struct rusage	*usage;
+	int				stage;
+
+	ft_dprintf(STDERR_FILENO, "{\"real_us\":%ld,\"user_us\":%ld,\"sys_us\":%ld,\
+\"stages\":[", totals[TIME_REAL], totals[TIME_USER], totals[TIME_SYS]);
+	stage = -1;
+	while (++stage < report->nb_timed_stage)
+	{
+		usage = &report->stage_usage[stage];
+		if (stage)
+			ft_dprintf(STDERR_FILENO, ",");
+		ft_dprintf(STDERR_FILENO, "{\"cmd\":\"%s\",\"user_us\":%ld,\
+\"sys_us\":%ld,\"maxrss_kb\":%ld,\"nvcsw\":%ld,\"nivcsw\":%ld}", \
+		escape_json_string(report->stage_name[stage], data), \
+		timeval_to_usec(usage->ru_utime), timeval_to_usec(usage->ru_stime), \
+		usage->ru_maxrss, usage->ru_nvcsw, usage->ru_nivcsw);
+	}
+	ft_dprintf(STDERR_FILENO, "]}\n");
+}
+
+/*
+	Termine la mesure du pipeline precede de "time" et ecrit le rapport
+	sur la sortie d'erreur, au format humain ou JSON.
+*/
+void	print_time_report(t_data *data)
+{
+	t_time_report	*report;
+	long			totals[3];
+
+	report = &data->utils->time_report;
+	if (!is_pipeline_timed(data))
+		return ;
+	totals[TIME_REAL] = elapsed_wall_usec(report->wall_start);
+	sum_time_report_usage(report, totals);
+	if (is_json_time_format_requested(data))
+		print_time_report_json(report, totals, data);
+	else
+		print_time_report_human(report, totals);
+	report->is_pipeline_timed = FALSE;
+}
@@ -0,0 +1,85 @@
+#include "../../include/minishell.h"
+
+long	timeval_to_usec(struct timeval tv)
+{
+	return (tv.tv_sec * USEC_PER_SEC + tv.tv_usec);
+}
+
+long	elapsed_wall_usec(struct timespec start)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - start.tv_sec) * USEC_PER_SEC \
+	+ (now.tv_nsec - start.tv_nsec) / NSEC_PER_USEC);
+}
+
+/*
+	Additionne le temps CPU consomme par le shell depuis le debut du
+	pipeline (builtins executes dans le parent) et celui de chaque enfant.
+	totals[0] = real, totals[1] = user, totals[2] = sys.
+*/
+void	sum_time_report_usage(t_time_report *report, long *totals)
+{
+	struct rusage	shell_now;
+	struct rusage	*usage;
+	int				stage;
+
+	getrusage(RUSAGE_SELF, &shell_now);
+	totals[TIME_USER] = timeval_to_usec(shell_now.ru_utime) \
+	- timeval_to_usec(report->shell_usage_start.ru_utime);
+	totals[TIME_SYS] = timeval_to_usec(shell_now.ru_stime) \
+	- timeval_to_usec(report->shell_usage_start.ru_stime);
+	stage = -1;
+	while (++stage < report->nb_timed_stage)
+	{
+		usage = &report->stage_usage[stage];
+		totals[TIME_USER] += timeval_to_usec(usage->ru_utime);
+		totals[TIME_SYS] += timeval_to_usec(usage->ru_stime);
+	}
+}
+
+/*
+	Ecrit \u00XX pour un caractere de controle (< 0x20) : les deux
+	premiers chiffres hexadecimaux sont toujours 0. Renvoie 6.
+*/
+int	write_json_control_escape(char *dst, char c)
+{
+	const char	*hex_digits;
+
+	hex_digits = "0123456789abcdef";
+	memcpy(dst, "\\u00", 4);
+	dst[4] = hex_digits[(unsigned char)c >> 4];
+	dst[5] = hex_digits[(unsigned char)c & 0xf];
+	return (6);
+}
+
+/*
+	Copie 'str' en echappant les caracteres interdits dans une chaine JSON.
+*/
+char	*escape_json_string(char *str, t_data *data)
+{
+	char	*escaped;
+	int		i;
+	int		j;
+
+	if (!str)
+		str = "";
+	escaped = malloc_track(data, ft_strlen(str) * 6 + 1);
+	if (!escaped)
+		return ("");
+	i = ZERO_INIT;
+	j = ZERO_INIT;
+	while (str[i])
+	{
+		if (str[i] == '"' || str[i] == '\\')
+			escaped[j++] = '\\';
+		if ((unsigned char)str[i] < ' ')
+			j += write_json_control_escape(escaped + j, str[i]);
+		else
+			escaped[j++] = str[i];
+		i++;
+	}
+	escaped[j] = '\0';
+	return (escaped);
+}
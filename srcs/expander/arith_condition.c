@@ -0,0 +1,39 @@
+#include "../../include/minishell.h"
+
+bool	is_arith_unary_operator(char c)
+{
+	return (c == '-' || c == '+' || c == '!' || c == '~');
+}
+
+bool	is_arith_name_start(char c)
+{
+	return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_');
+}
+
+bool	is_arith_name_char(char c)
+{
+	return (is_arith_name_start(c) || is_decimal_digit(c));
+}
+
+/*
+	Valeur d'un chiffre decimal ou hexadecimal, FAIL sinon.
+*/
+int	get_arith_digit_value(char c)
+{
+	if (is_decimal_digit(c))
+		return (c - '0');
+	if (c >= 'a' && c <= 'f')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'F')
+		return (c - 'A' + 10);
+	return (FAIL);
+}
+
+/*
+	0 && x et 1 || x : l'operande droit n'a pas besoin d'etre evalue.
+*/
+int	is_arith_short_circuit(int op, long long lhs)
+{
+	return ((op == ARITH_OP_AND && lhs == 0) \
+	|| (op == ARITH_OP_OR && lhs != 0));
+}
@@ -0,0 +1,121 @@
+#include "../../include/minishell.h"
+
+/*
+	Expression complete : une expression vide vaut 0, et tout ce qui reste
+	apres l'expression est une erreur de syntaxe.
+*/
+long long	parse_arith_expression(t_arith *ar)
+{
+	long long	value;
+
+	skip_arith_spaces(ar);
+	if (!ar->expr[ar->pos])
+		return (0);
+	value = parse_arith_ternary(ar);
+	skip_arith_spaces(ar);
+	if (!ar->error && ar->expr[ar->pos])
+		return (set_arith_error(ar, ERR_ARITH_SYNTAX, ar->pos));
+	return (value);
+}
+
+/*
+	Niveau le plus bas : cond ? a : b. La profondeur est bornee ici, car
+	les parentheses et les valeurs de variables repassent toutes par ce
+	niveau.
+*/
+long long	parse_arith_ternary(t_arith *ar)
+{
+	long long	cond;
+
+	ar->depth++;
+	if (ar->depth > ARITH_MAX_DEPTH)
+		return (set_arith_error(ar, ERR_ARITH_RECURSION, ar->pos));
+	cond = parse_arith_binary(ar, ARITH_PREC_MIN);
+	if (!ar->error && ar->expr[ar->pos] == '?')
+		cond = parse_arith_branches(ar, cond);
+	ar->depth--;
+	return (cond);
+}
+
+/*
+	La branche non retenue est analysee sans etre evaluee (noeval), pour
+	qu'une division par 0 n'y soit pas une erreur.
+*/
+long long	parse_arith_branches(t_arith *ar, long long cond)
+{
+	long long	if_true;
+	long long	if_false;
+
+	ar->pos++;
+	ar->noeval += (cond == 0);
+	if_true = parse_arith_ternary(ar);
+	ar->noeval -= (cond == 0);
+	skip_arith_spaces(ar);
+	if (ar->error)
+		return (0);
+	if (ar->expr[ar->pos] != ':')
+		return (set_arith_error(ar, ERR_ARITH_COLON, ar->pos));
+	ar->pos++;
+	ar->noeval += (cond != 0);
+	if_false = parse_arith_ternary(ar);
+	ar->noeval -= (cond != 0);
+	if (cond)
+		return (if_true);
+	return (if_false);
+}
+
+/*
+	Precedence climbing : on lit un operande, puis tant que l'operateur
+	suivant est au moins aussi prioritaire que 'min_precedence', son
+	operande droit est lu au niveau au-dessus. '**' est associatif a
+	droite, les autres a gauche ; && et || ne font qu'analyser leur
+	operande droit quand le gauche suffit.
+*/
+long long	parse_arith_binary(t_arith *ar, int min_precedence)
+{
+	const t_arith_op	*ops;
+	long long			lhs;
+	long long			rhs;
+	int					op;
+	int					skip;
+
+	ops = get_arith_operators();
+	lhs = parse_arith_unary(ar);
+	op = peek_arith_operator(ar);
+	while (!ar->error && op != ARITH_OP_NONE \
+	&& ops[op].precedence >= min_precedence)
+	{
+		ar->pos += strlen(ops[op].token);
+		skip = is_arith_short_circuit(op, lhs);
+		ar->noeval += skip;
+		rhs = parse_arith_binary(\
+		ar, ops[op].precedence + (op != ARITH_OP_POW));
+		ar->noeval -= skip;
+		lhs = apply_arith_operator(ar, op, lhs, rhs);
+		op = peek_arith_operator(ar);
+	}
+	return (lhs);
+}
+
+/*
+	Renvoie l'id de l'operateur binaire en position courante, ou
+	ARITH_OP_NONE. La table met les operateurs de deux caracteres en
+	premier, pour que "<=" ne soit pas lu comme "<".
+*/
+int	peek_arith_operator(t_arith *ar)
+{
+	const t_arith_op	*ops;
+	int					op;
+
+	skip_arith_spaces(ar);
+	ops = get_arith_operators();
+	op = ZERO_INIT;
+	while (op < ARITH_OP_NB)
+	{
+		if (!ft_strncmp(ar->expr + ar->pos, ops[op].token, \
+		strlen(ops[op].token)))
+			return (op);
+		op++;
+	}
+	return (ARITH_OP_NONE);
+}
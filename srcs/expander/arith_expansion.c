@@ -0,0 +1,134 @@
+#include "../../include/minishell.h"
+
+/*
+	Longueur du $((...)) qui commence en 'str', parentheses internes
+	comprises, ou 0 si 'str' n'ouvre pas une expansion arithmetique
+	complete (pas de '))' fermant au bon niveau).
+*/
+size_t	get_arith_expansion_length(const char *str)
+{
+	size_t	i;
+	int		depth;
+
+	if (ft_strncmp(str, ARITH_OPEN, ARITH_OPEN_LEN))
+		return (0);
+	i = ARITH_OPEN_LEN;
+	depth = ZERO_INIT;
+	while (str[i])
+	{
+		if (str[i] == '(')
+			depth++;
+		else if (str[i] == ')' && depth)
+			depth--;
+		else if (str[i] == ')' && str[i + 1] == ')')
+			return (i + ARITH_CLOSE_LEN);
+		else if (str[i] == ')')
+			return (0);
+		i++;
+	}
+	return (0);
+}
+
+void	append_arith_result(t_expand *exp, long long value)
+{
+	char				digits[ARITH_RESULT_SIZE];
+	unsigned long long	magnitude;
+	int					len;
+
+	magnitude = (unsigned long long)value;
+	if (value < 0)
+	{
+		magnitude = -magnitude;
+		exp->value_of_expanded_var_from_env[\
+		exp->length_of_expanded_var_value++] = '-';
+	}
+	len = ZERO_INIT;
+	while (len == 0 || magnitude)
+	{
+		digits[len++] = '0' + magnitude % 10;
+		magnitude /= 10;
+	}
+	while (len)
+		exp->value_of_expanded_var_from_env[\
+		exp->length_of_expanded_var_value++] = digits[--len];
+}
+
+/*
+	Evalue 'expr' en entiers 64 bits, dans le processus du shell. En cas
+	d'erreur, le message est affiche a la bash et FALSE est renvoye.
+*/
+bool	evaluate_arith(t_data *data, const char *expr, long long *result)
+{
+	t_arith	ar;
+
+	ar.data = data;
+	ar.expr = expr;
+	ar.error = NULL;
+	ar.pos = ZERO_INIT;
+	ar.error_pos = ZERO_INIT;
+	ar.operand_pos = ZERO_INIT;
+	ar.depth = ZERO_INIT;
+	ar.noeval = ZERO_INIT;
+	*result = parse_arith_expression(&ar);
+	if (!ar.error)
+		return (TRUE);
+	report_arith_error(&ar);
+	return (FALSE);
+}
+
+/*
+	La valeur d'une variable est elle-meme evaluee comme une expression
+	(a=b, b=3 : $((a)) vaut 3). En cas d'erreur, l'expression courante
+	reste celle de la variable pour que le message la montre.
+*/
+long long	evaluate_arith_value(t_arith *ar, const char *value)
+{
+	const char	*saved_expr;
+	size_t		saved_pos;
+	long long	result;
+
+	ar->depth++;
+	if (ar->depth > ARITH_MAX_DEPTH)
+		return (set_arith_error(ar, ERR_ARITH_RECURSION, ar->pos));
+	saved_expr = ar->expr;
+	saved_pos = ar->pos;
+	ar->expr = value;
+	ar->pos = ZERO_INIT;
+	result = parse_arith_expression(ar);
+	if (ar->error)
+		return (0);
+	ar->expr = saved_expr;
+	ar->pos = saved_pos;
+	ar->depth--;
+	return (result);
+}
+
+/*
+	'w' pointe sur le '$' d'un $((...)) de 'len' caracteres. Le resultat
+	est ecrit en decimal dans le mot developpe, sans processus. Une erreur
+	arrete le developpement de la ligne, avec le code de retour 1.
+*/
+int	expand_arith_expression(char *w, size_t len, t_expand *exp, t_data *data)
+{
+	char		*expr;
+	size_t		expr_len;
+	long long	value;
+
+	exp->var_env_match_found = FOUND;
+	expr_len = len - ARITH_OPEN_LEN - ARITH_CLOSE_LEN;
+	expr = malloc(sizeof(char) * (expr_len + sizeof('\0')));
+	if (expr)
+	{
+		memcpy(expr, w + ARITH_OPEN_LEN, expr_len);
+		expr[expr_len] = '\0';
+	}
+	if (expr && evaluate_arith(data, expr, &value))
+		append_arith_result(exp, value);
+	else
+	{
+		exp->has_arith_error = TRUE;
+		g_globi = 1;
+	}
+	free(expr);
+	return ((int)len);
+}
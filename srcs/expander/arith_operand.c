@@ -0,0 +1,117 @@
+#include "../../include/minishell.h"
+
+long long	parse_arith_unary(t_arith *ar)
+{
+	char		op;
+	long long	value;
+
+	skip_arith_spaces(ar);
+	op = ar->expr[ar->pos];
+	if (!is_arith_unary_operator(op))
+		return (parse_arith_primary(ar));
+	ar->pos++;
+	ar->depth++;
+	if (ar->depth > ARITH_MAX_DEPTH)
+		return (set_arith_error(ar, ERR_ARITH_RECURSION, ar->pos));
+	value = parse_arith_unary(ar);
+	ar->depth--;
+	return (apply_arith_unary(op, value));
+}
+
+/*
+	Operande : nombre, nom de variable (avec ou sans '$'), $?, $(...),
+	ou expression entre parentheses ; un $((...)) imbrique est lu comme
+	une parenthese de plus.
+*/
+long long	parse_arith_primary(t_arith *ar)
+{
+	char	c;
+
+	ar->operand_pos = ar->pos;
+	if (ar->expr[ar->pos] == '$' && ar->expr[ar->pos + 1] == '?')
+	{
+		ar->pos += 2;
+		return (g_globi);
+	}
+	if (ar->expr[ar->pos] == '$' \
+	&& !get_arith_expansion_length(ar->expr + ar->pos) \
+	&& get_cmd_subst_length(ar->expr + ar->pos))
+		return (parse_arith_cmd_subst(ar));
+	if (ar->expr[ar->pos] == '$')
+		ar->pos++;
+	c = ar->expr[ar->pos];
+	if (c == '(')
+		return (parse_arith_group(ar));
+	if (is_decimal_digit(c))
+		return (parse_arith_number(ar));
+	if (is_arith_name_start(c))
+		return (parse_arith_variable(ar));
+	return (set_arith_error(ar, ERR_ARITH_OPERAND, ar->pos));
+}
+
+long long	parse_arith_group(t_arith *ar)
+{
+	long long	value;
+
+	ar->pos++;
+	value = parse_arith_ternary(ar);
+	skip_arith_spaces(ar);
+	if (ar->error)
+		return (0);
+	if (ar->expr[ar->pos] != ')')
+		return (set_arith_error(ar, ERR_ARITH_PAREN, ar->pos));
+	ar->pos++;
+	return (value);
+}
+
+/*
+	Decimal, 0x hexadecimal ou 0 octal, comme dans bash. Le nombre est
+	construit chiffre par chiffre en non signe : un depassement boucle sur
+	64 bits. Un chiffre ou une lettre qui suit le nombre (08, 12abc) est
+	une erreur.
+*/
+long long	parse_arith_number(t_arith *ar)
+{
+	const char			*start;
+	unsigned long long	value;
+	int					base;
+	int					digit;
+
+	start = ar->expr + ar->pos;
+	base = 10;
+	if (start[0] == '0' && (start[1] == 'x' || start[1] == 'X'))
+		ar->pos += 2;
+	if (start[0] == '0')
+		base = 8 + 8 * (ar->expr + ar->pos != start);
+	value = ZERO_INIT;
+	digit = get_arith_digit_value(ar->expr[ar->pos]);
+	while (digit != FAIL && digit < base)
+	{
+		value = value * base + digit;
+		digit = get_arith_digit_value(ar->expr[++ar->pos]);
+	}
+	if (is_arith_name_char(ar->expr[ar->pos]))
+		return (set_arith_error(ar, ERR_ARITH_BASE, start - ar->expr));
+	return ((long long)value);
+}
+
+/*
+	La valeur est lue directement dans l'index de l'environnement ; une
+	variable absente ou vide vaut 0.
+*/
+long long	parse_arith_variable(t_arith *ar)
+{
+	const char	*name;
+	char		*value;
+	size_t		len;
+
+	name = ar->expr + ar->pos;
+	len = ZERO_INIT;
+	while (is_arith_name_char(name[len]))
+		len++;
+	ar->pos += len;
+	value = find_env_value(ar->data, name, len);
+	if (!value || !*value)
+		return (0);
+	return (evaluate_arith_value(ar, value));
+}
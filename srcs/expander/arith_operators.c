@@ -0,0 +1,82 @@
+#include "../../include/minishell.h"
+
+/*
+	Operateurs binaires indexes par leur id (ARITH_OP_POW...), avec leur
+	priorite bash : plus le nombre est grand, plus l'operateur lie fort.
+*/
+const t_arith_op	*get_arith_operators(void)
+{
+	static const t_arith_op	table[ARITH_OP_NB] = {
+	{"**", 11}, {"<<", 8}, {">>", 8}, {"<=", 7}, {">=", 7},
+	{"==", 6}, {"!=", 6}, {"&&", 2}, {"||", 1}, {"*", 10},
+	{"/", 10}, {"%", 10}, {"+", 9}, {"-", 9}, {"<", 7},
+	{">", 7}, {"&", 5}, {"^", 4}, {"|", 3}};
+
+	return (table);
+}
+
+/*
+	Les additions et multiplications passent par l'arithmetique non
+	signee, pour boucler sur 64 bits comme bash au lieu de deborder.
+*/
+long long	apply_arith_operator(\
+t_arith *ar, int op, long long lhs, long long rhs)
+{
+	if (op == ARITH_OP_ADD)
+		return ((long long)((unsigned long long)lhs + rhs));
+	if (op == ARITH_OP_SUB)
+		return ((long long)((unsigned long long)lhs - rhs));
+	if (op == ARITH_OP_MUL)
+		return ((long long)((unsigned long long)lhs * rhs));
+	if (op == ARITH_OP_DIV || op == ARITH_OP_MOD)
+		return (divide_arith(ar, op, lhs, rhs));
+	if (op == ARITH_OP_POW)
+		return (power_arith(ar, lhs, rhs));
+	return (apply_arith_bitwise(op, lhs, rhs));
+}
+
+long long	apply_arith_bitwise(int op, long long lhs, long long rhs)
+{
+	if (op == ARITH_OP_SHL)
+		return ((long long)((unsigned long long)lhs \
+		<< (rhs & ARITH_SHIFT_MASK)));
+	if (op == ARITH_OP_SHR)
+		return (lhs >> (rhs & ARITH_SHIFT_MASK));
+	if (op == ARITH_OP_BAND)
+		return (lhs & rhs);
+	if (op == ARITH_OP_XOR)
+		return (lhs ^ rhs);
+	if (op == ARITH_OP_BOR)
+		return (lhs | rhs);
+	return (compare_arith(op, lhs, rhs));
+}
+
+long long	compare_arith(int op, long long lhs, long long rhs)
+{
+	if (op == ARITH_OP_LT)
+		return (lhs < rhs);
+	if (op == ARITH_OP_GT)
+		return (lhs > rhs);
+	if (op == ARITH_OP_LE)
+		return (lhs <= rhs);
+	if (op == ARITH_OP_GE)
+		return (lhs >= rhs);
+	if (op == ARITH_OP_EQ)
+		return (lhs == rhs);
+	if (op == ARITH_OP_NE)
+		return (lhs != rhs);
+	if (op == ARITH_OP_AND)
+		return (lhs && rhs);
+	return (lhs || rhs);
+}
+
+long long	apply_arith_unary(char op, long long value)
+{
+	if (op == '-')
+		return ((long long)(0ULL - (unsigned long long)value));
+	if (op == '!')
+		return (value == 0);
+	if (op == '~')
+		return (~value);
+	return (value);
+}
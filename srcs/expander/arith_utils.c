@@ -0,0 +1,66 @@
+#include "../../include/minishell.h"
+
+void	skip_arith_spaces(t_arith *ar)
+{
+	while (ar->expr[ar->pos] && is_white_space(ar->expr[ar->pos]))
+		ar->pos++;
+}
+
+/*
+	Ne garde que la premiere erreur : c'est celle que bash affiche.
+	Renvoie 0 pour que l'appelant puisse s'en servir comme valeur.
+*/
+long long	set_arith_error(t_arith *ar, const char *message, size_t pos)
+{
+	if (!ar->error)
+	{
+		ar->error = message;
+		ar->error_pos = pos;
+	}
+	return (0);
+}
+
+void	report_arith_error(t_arith *ar)
+{
+	ft_dprintf(STDERR_FILENO, ERR_ARITH, ar->expr, ar->error, \
+	ar->expr + ar->error_pos);
+}
+
+/*
+	LLONG_MIN / -1 deborde en C : on renvoie ce que donne bash.
+*/
+long long	divide_arith(t_arith *ar, int op, long long lhs, long long rhs)
+{
+	if (rhs == 0 && ar->noeval)
+		return (0);
+	if (rhs == 0)
+		return (set_arith_error(ar, ERR_ARITH_DIV_ZERO, ar->operand_pos));
+	if (rhs == -1 && op == ARITH_OP_MOD)
+		return (0);
+	if (rhs == -1)
+		return ((long long)(0ULL - (unsigned long long)lhs));
+	if (op == ARITH_OP_DIV)
+		return (lhs / rhs);
+	return (lhs % rhs);
+}
+
+long long	power_arith(t_arith *ar, long long base, long long exponent)
+{
+	unsigned long long	result;
+	unsigned long long	factor;
+
+	if (exponent < 0 && ar->noeval)
+		return (0);
+	if (exponent < 0)
+		return (set_arith_error(ar, ERR_ARITH_EXPONENT, ar->operand_pos));
+	result = 1;
+	factor = (unsigned long long)base;
+	while (exponent)
+	{
+		if (exponent & 1)
+			result *= factor;
+		factor *= factor;
+		exponent >>= 1;
+	}
+	return ((long long)result);
+}
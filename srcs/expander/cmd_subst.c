@@ -0,0 +1,145 @@
+#include "../../include/minishell.h"
+
+/*
+	Longueur du $(...) qui commence en 'str', parentheses internes
+	comprises, ou 0 s'il n'est pas ferme. Les parentheses entre quotes
+	ne comptent pas : $(echo ")") est une seule substitution.
+*/
+size_t	get_cmd_subst_length(const char *str)
+{
+	size_t	i;
+	int		depth;
+	char	quote;
+
+	if (ft_strncmp(str, CMD_SUBST_OPEN, CMD_SUBST_OPEN_LEN))
+		return (0);
+	i = CMD_SUBST_OPEN_LEN;
+	depth = ZERO_INIT;
+	quote = '\0';
+	while (str[i])
+	{
+		if (quote && str[i] == quote)
+			quote = '\0';
+		else if (!quote && (str[i] == '\'' || str[i] == '"'))
+			quote = str[i];
+		else if (!quote && str[i] == '(')
+			depth++;
+		else if (!quote && str[i] == ')' && !depth)
+			return (i + CMD_SUBST_CLOSE_LEN);
+		else if (!quote && str[i] == ')')
+			depth--;
+		i++;
+	}
+	return (0);
+}
+
+/*
+	Lexe et verifie la commande interne avec le lexer et le parser du
+	shell, sans toucher a la ligne en cours d'expansion. Renvoie le
+	sous-plan, ou NULL s'il est vide ou a une erreur de syntaxe.
+*/
+t_lexer	*parse_cmd_subst_plan(t_data *data, char *inner)
+{
+	t_lexer	*saved_lexer;
+	char	*saved_input;
+	t_lexer	*plan;
+
+	saved_lexer = data->lexer_list;
+	saved_input = data->minishell_input_cmd;
+	data->minishell_input_cmd = add_spaces_around_operators(data, inner);
+	plan = NULL;
+	if (data->minishell_input_cmd)
+	{
+		ft_init_lexer_process(data);
+		plan = data->lexer_list;
+		if (plan && (!err_code_directory(data) || !ft_parser(data)))
+			plan = NULL;
+	}
+	data->lexer_list = saved_lexer;
+	data->minishell_input_cmd = saved_input;
+	return (plan);
+}
+
+/*
+	Le fils ecrit dans le pipe et execute le sous-plan deja lexe avec
+	l'executeur du shell : la derniere commande remplace le fils (pas de
+	fork de plus), et les substitutions imbriquees se font dans le fils.
+*/
+void	run_cmd_subst_child(t_data *data, t_lexer *plan, int *fd)
+{
+	drop_unread_input(data);
+	close(fd[0]);
+	if (ft_dup2(fd[1], STDOUT_FILENO) < 0)
+	{
+		perror("dup2");
+		g_globi = 1;
+		ft_exit_child(NULL, data);
+	}
+	close(fd[1]);
+	data->utils->head_cmd_lst = NULL;
+	data->lexer_list = plan;
+	strip_time_keyword(data);
+	if (expand(data->quote, data->full_env_var_copy_gamma, \
+	data->lexer_list, data) && data->lexer_list->cmd_segment)
+	{
+		ft_init_exec(data);
+		data->is_tail_exec_allowed = TRUE;
+		manage_execution_resources(data);
+	}
+	ft_exit_child(NULL, data);
+}
+
+/*
+	Lance le sous-plan dans un fils et lit toute sa sortie dans le tampon
+	de capture du shell, sans fichier temporaire. L'entree non lue est
+	rendue avant le fork, au cas ou la commande lirait stdin.
+*/
+bool	run_cmd_subst(t_data *data, t_lexer *plan)
+{
+	int		fd[2];
+	pid_t	pid;
+
+	if (ft_pipe(fd, 0) < 0)
+	{
+		perror("pipe");
+		return (FALSE);
+	}
+	release_unread_input(data);
+	pid = ft_fork();
+	if (pid == CHILD_PROCESS)
+		run_cmd_subst_child(data, plan, fd);
+	close(fd[1]);
+	if (pid > 0)
+		read_cmd_subst_output(data, fd[0]);
+	close(fd[0]);
+	if (pid < 0)
+	{
+		perror("fork");
+		return (FALSE);
+	}
+	wait_cmd_subst_child(pid);
+	reclaim_unread_input(data);
+	return (TRUE);
+}
+
+/*
+	'w' pointe sur le '$' d'un $(...) de 'len' caracteres. Renvoie TRUE
+	si la commande a tourne ; sa sortie est alors dans le tampon de
+	capture, vide sinon.
+*/
+bool	capture_cmd_subst(t_data *data, const char *w, size_t len)
+{
+	size_t	inner_len;
+	char	*inner;
+	t_lexer	*plan;
+
+	data->utils->cmd_subst.len = ZERO_INIT;
+	inner_len = len - CMD_SUBST_OPEN_LEN - CMD_SUBST_CLOSE_LEN;
+	inner = malloc_track(data, sizeof(char) * (inner_len + sizeof('\0')));
+	if (!inner)
+		return (FALSE);
+	memcpy(inner, w + CMD_SUBST_OPEN_LEN, inner_len);
+	inner[inner_len] = '\0';
+	plan = parse_cmd_subst_plan(data, inner);
+	return (plan && run_cmd_subst(data, plan));
+}
@@ -0,0 +1,91 @@
+#include "../../include/minishell.h"
+
+/*
+	Le majorant calcule avant l'expansion ne connait pas la sortie des
+	commandes : on agrandit le mot de 'extra' octets avant de l'y copier.
+*/
+bool	reserve_expanded_word(t_expand *exp, t_data *data, size_t extra)
+{
+	char	*buffer;
+	size_t	capacity;
+
+	capacity = exp->capacity_of_expanded_var_value + extra;
+	buffer = malloc_track(data, sizeof(char) * capacity);
+	if (!buffer)
+		return (FALSE);
+	memcpy(buffer, exp->value_of_expanded_var_from_env, \
+	exp->length_of_expanded_var_value);
+	ft_free(exp->value_of_expanded_var_from_env, data);
+	exp->value_of_expanded_var_from_env = buffer;
+	exp->capacity_of_expanded_var_value = capacity;
+	return (TRUE);
+}
+
+/*
+	Les octets nuls sont ignores, comme dans bash, sinon ils couperaient
+	le mot developpe. Les quotes de la sortie (et la marque elle-meme)
+	sont precedees de LITERAL_MARK : elles restent dans le mot au lieu
+	d'etre retirees, d'ou la place reservee pour deux fois la sortie.
+*/
+void	append_cmd_subst_output(t_expand *exp, t_data *data, int is_quoted)
+{
+	t_capture	*capture;
+	char		*word;
+	char		c;
+	size_t		i;
+
+	capture = &data->utils->cmd_subst;
+	if (!capture->len \
+	|| !reserve_expanded_word(exp, data, capture->len * 2))
+		return ;
+	word = exp->value_of_expanded_var_from_env;
+	i = ZERO_INIT;
+	while (i < capture->len)
+	{
+		c = capture->buffer[i++];
+		if (!is_quoted && (c == '\n' || c == '\t'))
+			c = ' ';
+		if (c == '\'' || c == '"' || c == LITERAL_MARK)
+			word[exp->length_of_expanded_var_value++] = LITERAL_MARK;
+		if (c)
+			word[exp->length_of_expanded_var_value++] = c;
+	}
+}
+
+/*
+	'w' pointe sur le '$' d'un $(...). La sortie de la commande remplace
+	la substitution ; hors double quotes, ses retours a la ligne et
+	tabulations deviennent des espaces pour le decoupage en mots.
+*/
+int	expand_command_subst(char *w, t_expand *exp, t_data *data, t_quote *state)
+{
+	size_t	len;
+
+	exp->var_env_match_found = FOUND;
+	len = get_cmd_subst_length(w);
+	if (capture_cmd_subst(data, w, len))
+		append_cmd_subst_output(exp, data, state->doubl_quot_status);
+	return ((int)len);
+}
+
+/*
+	Un $(...) dans une expression arithmetique : la sortie de la commande
+	est evaluee comme la valeur d'une variable.
+*/
+long long	parse_arith_cmd_subst(t_arith *ar)
+{
+	size_t		len;
+	t_capture	*capture;
+	char		*output;
+
+	len = get_cmd_subst_length(ar->expr + ar->pos);
+	capture_cmd_subst(ar->data, ar->expr + ar->pos, len);
+	ar->pos += len;
+	capture = &ar->data->utils->cmd_subst;
+	output = malloc_track(ar->data, sizeof(char) * (capture->len + 1));
+	if (!output)
+		return (0);
+	memcpy(output, capture->buffer, capture->len);
+	output[capture->len] = '\0';
+	return (evaluate_arith_value(ar, output));
+}
@@ -0,0 +1,73 @@
+#include "../../include/minishell.h"
+
+/*
+	Le tampon de capture est garde d'une substitution a l'autre (et d'une
+	ligne a l'autre, avec l'environnement) et double quand il manque de
+	place ; l'ancien est libere.
+*/
+bool	reserve_cmd_subst_buffer(t_data *data, t_capture *capture, size_t size)
+{
+	size_t	capacity;
+	char	*buffer;
+
+	if (size <= capture->capacity)
+		return (TRUE);
+	capacity = capture->capacity;
+	if (!capacity)
+		capacity = CMD_SUBST_READ_SIZE;
+	while (capacity < size)
+		capacity *= 2;
+	buffer = malloc_track(data, capacity);
+	if (!buffer)
+		return (FALSE);
+	keep_env_memory(data, buffer);
+	if (capture->len)
+		memcpy(buffer, capture->buffer, capture->len);
+	if (capture->buffer)
+	{
+		drop_env_memory(data, capture->buffer);
+		ft_free(capture->buffer, data);
+	}
+	capture->buffer = buffer;
+	capture->capacity = capacity;
+	return (TRUE);
+}
+
+/*
+	Chaque read demande au moins CMD_SUBST_READ_SIZE octets, la taille
+	d'un pipe Linux : un seul appel vide le pipe quand il est plein.
+	Les '\n' de fin sont retires, comme dans bash.
+*/
+void	read_cmd_subst_output(t_data *data, int fd)
+{
+	t_capture	*capture;
+	ssize_t		nread;
+
+	capture = &data->utils->cmd_subst;
+	capture->len = ZERO_INIT;
+	while (reserve_cmd_subst_buffer(\
+	data, capture, capture->len + CMD_SUBST_READ_SIZE))
+	{
+		nread = read(fd, capture->buffer + capture->len, \
+		capture->capacity - capture->len);
+		if (nread < 0 && errno == EINTR)
+			continue ;
+		if (nread <= 0)
+			break ;
+		capture->len += nread;
+	}
+	while (capture->len && capture->buffer[capture->len - 1] == '\n')
+		capture->len--;
+}
+
+void	wait_cmd_subst_child(pid_t pid)
+{
+	int	wstatus;
+
+	if (waitpid(pid, &wstatus, 0) < 0)
+		return ;
+	if (WIFEXITED(wstatus))
+		g_globi = WEXITSTATUS(wstatus);
+	else if (WIFSIGNALED(wstatus))
+		g_globi = 128 + WTERMSIG(wstatus);
+}
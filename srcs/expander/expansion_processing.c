@@ -34,38 +34,37 @@ t_lexer **expnd, t_quote *state, t_expand *exp, t_data *data)
 	}
 }
 
-void	update_lengths_for_dollar_question_mark(\
-int *expanded_length, int *index, t_data *data)
-{
-	*expanded_length += ft_strlen(data->utils->g_signal_in_char_format);
-	*index += SKIP_DOLLAR_QUESTION_MARK;
-}
-
+/*
+	Majorant de la taille du mot une fois developpe : sa longueur actuelle,
+	plus la valeur de chaque variable trouvee dans l'environnement courant,
+	celle du code d'erreur pour chaque $? et la place d'un resultat
+	64 bits pour chaque $((...)). Les noms retires ne sont pas
+	deduits, la taille reste donc toujours suffisante.
+*/
 void	length_of_env_variable_value(\
 t_lexer **exp, t_quote *state, t_data *data, int *expanded_length)
 {
-	int	index;
+	char	*segment;
+	char	*value;
+	int		index;
+	int		name_len;
 
+	segment = (*exp)->cmd_segment;
+	*expanded_length += ft_strlen(segment);
 	index = ZERO_INIT;
-	while ((*exp)->cmd_segment[index])
+	while (segment[index])
 	{
-		update_quoting_state((*exp)->cmd_segment[index], state);
-		if (is_current_char_dollar_sign(*exp, index))
-		{
-			if (is_next_char_question_mark(*exp, index))
-				update_lengths_for_dollar_question_mark(\
-				expanded_length, &index, data);
-			else
-				index += calculate_expanded_env_var_length(\
-				&(*exp)->cmd_segment[index], \
-				data->full_env_var_copy_alpha, state, expanded_length);
-			if (is_special_char_found_with_state_not_found(*exp, state, index))
-				(*expanded_length)++;
-		}
-		else
-		{
-			(*expanded_length)++;
-			index++;
-		}
+		if (segment[index++] != '$')
+			continue ;
+		if (segment[index] == '?')
+			*expanded_length += \
+			ft_strlen(data->utils->g_signal_in_char_format);
+		if (segment[index] == '(')
+			*expanded_length += ARITH_RESULT_SIZE;
+		name_len = length_of_expansion_name(segment + index, state);
+		value = find_env_value(data, segment + index, name_len);
+		if (value)
+			*expanded_length += ft_strlen(value);
+		index += name_len;
 	}
 }
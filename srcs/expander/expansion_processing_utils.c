@@ -29,29 +29,13 @@ int	append_curnt_error_code_to_expansion_struc(t_expand *exp, t_data *data)
 int	expand_env_vars_with_question_mark_handling(\
 char *w, t_expand *exp, t_data *data, t_quote *state)
 {
-	int	i;
-	int	env_var_char_idx;
+	size_t	arith_len;
 
-	i = 1;
-	data->env_var_line_idx = -1;
-	exp->var_env_match_found = ZERO_INIT;
-	while (is_valid_env_var_entry(data))
-	{
-		env_var_char_idx = 0;
-		i = 1;
-		if (is_current_char_question_mark(w, i))
-			return (find_and_expand_env_var_with_special_char(\
-			w, exp, data, state));
-		if (is_char_matching_env_var(\
-		w, i, data->full_env_var_copy_gamma[data->env_var_line_idx], \
-		env_var_char_idx))
-		{
-			i = find_and_expand_env_var_with_special_char(w, exp, data, state);
-			if (is_expansion_found(exp))
-				return (i);
-		}
-	}
-	if (is_expansion_not_found(exp))
-		return (handle_unfound_expansion_word(w, state));
-	return (i);
+	exp->var_env_match_found = NOT_FOUND;
+	arith_len = get_arith_expansion_length(w);
+	if (arith_len)
+		return (expand_arith_expression(w, arith_len, exp, data));
+	if (get_cmd_subst_length(w))
+		return (expand_command_subst(w, exp, data, state));
+	return (find_and_expand_env_var_with_special_char(w, exp, data, state));
 }
@@ -1,33 +1,39 @@
 #include "../../include/minishell.h"
 
+/*
+	'w' pointe sur le '$'. Le nom (jusqu'a la fin, un '$' ou un caractere
+	special) est cherche dans l'index de l'environnement courant ; la
+	valeur est copiee d'un bloc. Renvoie le nombre de caracteres consommes.
+*/
 int	find_and_expand_env_var_with_special_char(\
 char *w, t_expand *exp, t_data *data, t_quote *state)
 {
-	int	i;
-	int	env_var_char_idx;
+	int		name_len;
+	char	*value;
+	size_t	value_len;
 
-	i = -1;
-	env_var_char_idx = ZERO_INIT;
 	if (w[1] == '?')
 		return (append_curnt_error_code_to_expansion_struc(exp, data));
-	i = 1;
-	while (is_matching_env_var_name(w, data, i, env_var_char_idx))
-	{
-		env_var_char_idx++;
-		i++;
-	}
-	if (is_word_end_or_special(w, i, state) \
-	&& is_env_var_name_with_equal_sign(data, env_var_char_idx))
-	{
-		exp->var_env_match_found = 1;
-		while (data->full_env_var_copy_gamma[data->\
-		env_var_line_idx][++env_var_char_idx])
-			exp->value_of_expanded_var_from_env[exp->\
-			length_of_expanded_var_value++] = data->\
-			full_env_var_copy_gamma[data->env_var_line_idx][env_var_char_idx];
-		return (i);
-	}
-	return (i);
+	name_len = length_of_expansion_name(w + 1, state);
+	value = find_env_value(data, w + 1, name_len);
+	if (!value)
+		return (handle_unfound_expansion_word(w, state));
+	exp->var_env_match_found = FOUND;
+	value_len = ft_strlen(value);
+	memcpy(exp->value_of_expanded_var_from_env \
+	+ exp->length_of_expanded_var_value, value, value_len);
+	exp->length_of_expanded_var_value += value_len;
+	return (name_len + 1);
+}
+
+int	length_of_expansion_name(char *name, t_quote *state)
+{
+	int	len;
+
+	len = ZERO_INIT;
+	while (!is_word_end_or_special(name, len, state))
+		len++;
+	return (len);
 }
 
 int	handle_unfound_expansion_word(char *w, t_quote *state)
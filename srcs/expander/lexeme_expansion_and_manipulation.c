@@ -1,12 +1,11 @@
 #include "../../include/minishell.h"
 
 char	*allocate_memory_for_expanded_word(\
-t_lexer **exp, t_quote *st, char **env, t_data *data)
+t_lexer **exp, t_quote *st, int *capacity, t_data *data)
 {
 	int		len;
 	char	*str;
 
-	env = NULL;
 	len = ZERO_INIT;
 	st->var_env_match_confirmed = ZERO_INIT;
 	if (is_dollar_char_then_end_of_string(*exp))
@@ -15,6 +14,7 @@ t_lexer **exp, t_quote *st, char **env, t_data *data)
 	str = malloc_track(data, sizeof(char) * (len + sizeof('\0')));
 	if (!str)
 		return (NULL);
+	*capacity = len + sizeof('\0');
 	return (str);
 }
 
@@ -60,18 +60,24 @@ char **insert, t_lexer *back, t_data *data, int len)
 		tmp = malloc_track(data, sizeof(t_lexer) * (1));
 		if (!tmp)
 			return ;
-		if (back)
-			back->next = tmp;
-		if (data->lexer_list->next)
-			data->lexer_list->next->prev = tmp;
 		tmp->prev = back;
-		tmp->next = data->lexer_list->next;
+		tmp->next = back->next;
+		if (back->next)
+			back->next->prev = tmp;
+		back->next = tmp;
 		tmp->token = ARG;
+		tmp->is_delimiter_quoted = FALSE;
+		tmp->heredoc_fd = INPUT_FD_NOT_SET;
+		tmp->builtin_id = BUILTIN_UNRESOLVED;
 		tmp->cmd_segment = ft_strdup(data, insert[i]);
 		back = tmp;
 	}
 }
 
+/*
+	Un argument non quote qui se developpe en rien ($VIDE, $(true))
+	disparait de la liste, comme dans bash, au lieu de couper la commande.
+*/
 void	replace_and_extend_chained_list_lexeme(\
 t_lexer **old_node, char **to_insert, t_data *data)
 {
@@ -80,6 +86,13 @@ t_lexer **old_node, char **to_insert, t_data *data)
 
 	len = count_string_array_elements(to_insert);
 	back = (*old_node)->prev;
+	if (!len && back && (*old_node)->token == ARG)
+	{
+		back->next = (*old_node)->next;
+		if (back->next)
+			back->next->prev = back;
+		return ;
+	}
 	(*old_node)->cmd_segment = ft_strdup(data, to_insert[0]);
 	if (len > 1)
 	{
@@ -101,13 +114,11 @@ char *cmd_without_quotes_ready_for_expand, t_quote *state)
 	state->doubl_quot_status = ZERO_INIT;
 	while (original_cmd_with_quotes[++i])
 	{
-		if (is_double_quote_with_closed_single_quotes(\
-		original_cmd_with_quotes[i], state))
-		{
-			update_quoting_state(original_cmd_with_quotes[i], state);
-			continue ;
-		}
-		if (is_single_quote_with_closed_double_quotes(\
+		if (is_literal_mark(original_cmd_with_quotes + i))
+			i++;
+		else if (is_double_quote_with_closed_single_quotes(\
+		original_cmd_with_quotes[i], state) \
+		|| is_single_quote_with_closed_double_quotes(\
 		original_cmd_with_quotes[i], state))
 		{
 			update_quoting_state(original_cmd_with_quotes[i], state);
@@ -13,6 +13,6 @@ t_expand *exp, t_data *data, t_lexer **expnd, t_quote *st)
 	data->utils->g_signal_in_char_format = \
 	convert_int_to_string_with_tracking(data, g_globi);
 	exp->value_of_expanded_var_from_env = \
-	allocate_memory_for_expanded_word(expnd, st, data->\
-	full_env_var_copy_gamma, data);
+	allocate_memory_for_expanded_word(expnd, st, \
+	&exp->capacity_of_expanded_var_value, data);
 }
@@ -23,12 +23,17 @@ char *old, t_quote *state, t_data *data)
 	state->doubl_quot_status = 0;
 	while (old[++i])
 	{
+		if (is_literal_mark(old + i))
+		{
+			i++;
+			len++;
+			continue ;
+		}
 		update_quoting_state(old[i], state);
 		if (is_both_quotes_on(state))
 			len++;
-		if (is_double_quote_with_single_quote_closed(old[i], state))
-			continue ;
-		if (is_single_quote_with_double_quote_closed(old[i], state))
+		if (is_double_quote_with_single_quote_closed(old[i], state) \
+		|| is_single_quote_with_double_quote_closed(old[i], state))
 			continue ;
 		len++;
 	}
@@ -62,13 +67,15 @@ char *word, t_quote *state, char *str)
 	j = ZERO_INIT;
 	while (is_char_non_space_and_copyable(word[i]))
 	{
-		if (is_quote_not_part_of_string(word[i], state))
+		if (is_literal_mark(word + i))
 			i++;
-		else
+		else if (is_quote_not_part_of_string(word[i], state))
 		{
-			str[j++] = word[i];
 			i++;
+			continue ;
 		}
+		str[j++] = word[i];
+		i++;
 	}
 	str[j] = '\0';
 	return (str);
@@ -85,13 +92,15 @@ char *word, t_quote *state, t_data *data)
 	j = ZERO_INIT;
 	while (is_char_non_space_and_copyable(word[i]))
 	{
-		if (is_quote_not_part_of_string(word[i], state))
+		if (is_literal_mark(word + i))
 			i++;
-		else
+		else if (is_quote_not_part_of_string(word[i], state))
 		{
 			i++;
-			j++;
+			continue ;
 		}
+		i++;
+		j++;
 	}
 	str = malloc_track(data, sizeof(char) * (j + sizeof('\0')));
 	if (!str)
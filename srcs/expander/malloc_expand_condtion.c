@@ -15,6 +15,15 @@ bool	is_next_char_present(char *word, int index)
 	return (word[index + 1] != '\0');
 }
 
+/*
+	LITERAL_MARK precede un octet insere par une substitution de commande :
+	cet octet est copie tel quel et n'ouvre ni ne ferme aucune quote.
+*/
+bool	is_literal_mark(char *word)
+{
+	return (word[0] == LITERAL_MARK && word[1] != '\0');
+}
+
 bool	is_start_of_word(char *word, int index)
 {
 	return (word[index] != ' ' && (index == 0 || word[index - 1] == ' '));
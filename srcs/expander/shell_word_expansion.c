@@ -16,7 +16,7 @@ t_lexer **to_check, t_quote *state, t_expand *exp, t_data *data)
 			exp->dollar_sign_present = NEED_EXPAND;
 		if (is_singl_or_doubl_quote((*to_check)->cmd_segment[index]))
 			exp->sing_or_doub_quote_in_env_expansion = QUOTED;
-		index++;
+		index += get_expansion_step((*to_check)->cmd_segment + index);
 	}
 	if (is_expansion_not_required_and_quoted(exp))
 		(*to_check)->cmd_segment = create_cleaned_str_excluding_inactive_quots(\
@@ -30,10 +30,12 @@ void	process_lexer_for_expansion(\
 t_quote *state, t_data *data, t_expand *exp, t_lexer *lexeme)
 {
 	t_lexer	*current;
+	t_lexer	*next;
 
 	current = lexeme;
-	while (current)
+	while (current && !exp->has_arith_error)
 	{
+		next = current->next;
 		if (is_dollar_or_doubl_or_singl_quote(current->cmd_segment))
 		{
 			if (is_dollar_at_end(current->cmd_segment)
@@ -43,21 +45,27 @@ t_quote *state, t_data *data, t_expand *exp, t_lexer *lexeme)
 					exp);
 		}
 		reset_quoting_state(state);
-		current = current->next;
+		current = next;
 	}
 }
 
-void	expand(t_quote *state, char **env, t_lexer *tmp, t_data *data)
+/*
+	Renvoie FALSE si une expansion arithmetique a echoue : comme dans bash,
+	la ligne n'est alors pas executee.
+*/
+bool	expand(t_quote *state, char **env, t_lexer *tmp, t_data *data)
 {
 	t_expand	*exp;
 
 	data->full_env_var_copy_gamma = env;
 	state = malloc_track(data, sizeof(t_quote));
 	if (!state)
-		return ;
+		return (FALSE);
 	reset_quoting_state(state);
 	exp = malloc_track(data, sizeof(t_expand));
 	if (!exp)
-		return ;
+		return (FALSE);
+	exp->has_arith_error = FALSE;
 	process_lexer_for_expansion(state, data, exp, tmp);
+	return (!exp->has_arith_error);
 }
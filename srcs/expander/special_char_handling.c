@@ -11,13 +11,6 @@ int	is_next_char_decimal_digit(char *word)
 	return (word[FORWARD_OFFSET] && is_decimal_digit(word[FORWARD_OFFSET]));
 }
 
-int	is_special_char_found_with_state_not_found(\
-t_lexer *exp, t_quote *state, int index)
-{
-	return (state->var_env_match_confirmed == 0 && exp->cmd_segment[index] \
-	&& is_special_syntax_character(exp->cmd_segment[index], state));
-}
-
 int	is_next_char_question_mark(t_lexer *exp, int index)
 {
 	return (exp->cmd_segment[index + FORWARD_OFFSET] \
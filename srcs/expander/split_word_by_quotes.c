@@ -11,10 +11,11 @@ int	count_subwords_with_quote_states(char *word, t_quote *state)
 	state->singl_quot_status = ZERO_INIT;
 	while (word[index])
 	{
-		update_quoting_state(word[index], state);
+		if (!is_literal_mark(word + index))
+			update_quoting_state(word[index], state);
 		if (is_start_word_considering_quotes(word, index, state))
 			j++;
-		index++;
+		index += get_literal_step(word + index);
 	}
 	return (j);
 }
@@ -25,10 +26,8 @@ char	**split_word_by_quotes(t_data *data, char *word, t_quote *state)
 	int		j;
 	char	**arr;
 
-	arr = \
-	malloc_track(\
-	data, sizeof(char *) * (count_subwords_with_quote_states(\
-	word, state) + sizeof('\0')));
+	arr = malloc_track(data, sizeof(char *) \
+	* (count_subwords_with_quote_states(word, state) + sizeof('\0')));
 	if (!arr)
 		return (NULL);
 	index = ZERO_INIT;
@@ -37,13 +36,25 @@ char	**split_word_by_quotes(t_data *data, char *word, t_quote *state)
 	state->singl_quot_status = ZERO_INIT;
 	while (word[index])
 	{
-		update_quoting_state(word[index], state);
+		if (!is_literal_mark(word + index))
+			update_quoting_state(word[index], state);
 		if (is_start_word_considering_quotes(word, index, state))
 			arr[j++] = \
 			alloc_copy_word_excluding_quot_with_tracking(\
 			&word[index], state, data);
-		index++;
+		index += get_literal_step(word + index);
 	}
 	arr[j] = NULL;
 	return (arr);
 }
+
+/*
+	Un octet marque est saute avec sa marque : seul le decoupage sur les
+	espaces s'applique a la sortie d'une substitution de commande.
+*/
+int	get_literal_step(char *word)
+{
+	if (is_literal_mark(word))
+		return (2);
+	return (1);
+}
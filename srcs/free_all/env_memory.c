@@ -0,0 +1,66 @@
+#include "../../include/minishell.h"
+
+/*
+	Les donnees de l'environnement (noeuds et chaines "NOM=valeur") ont
+	leur propre liste, env_memory : une ligne peut ainsi rendre tout ce
+	qu'elle a alloue (release_trash_until) sans toucher aux variables
+	qu'elle a creees ou modifiees.
+*/
+void	keep_env_memory(t_data *data, void *add)
+{
+	if (add)
+		move_trash_node(\
+		&data->trash_memory, &data->env_memory, add, data->line_mark);
+}
+
+/*
+	Rend a la ligne en cours une allocation de l'environnement : elle sera
+	liberee avec le reste de la ligne, quand plus aucun tableau
+	d'environnement deja construit ne peut pointer dessus.
+*/
+void	drop_env_memory(t_data *data, void *add)
+{
+	if (add)
+		move_trash_node(&data->env_memory, &data->trash_memory, add, NULL);
+}
+
+/*
+	Valeur remplacee ou retiree : la liste d'env et celle d'export peuvent
+	partager la meme chaine, elle n'est rendue que quand aucune des deux
+	(ni un tampon de variable chaude) n'y pointe plus.
+*/
+void	release_env_value(t_data *data, char *value)
+{
+	if (value && !is_env_value_in_use(data->utils, value))
+		drop_env_memory(data, value);
+}
+
+/*
+	La liste des allocations est remplie par la tete : tout ce qui est
+	au-dessus de mark a ete alloue depuis, on le libere.
+*/
+void	release_trash_until(t_data *data, t_trash_memory *mark)
+{
+	t_trash_memory	*next;
+
+	while (data->trash_memory && data->trash_memory != mark)
+	{
+		next = data->trash_memory->next;
+		free(data->trash_memory->add);
+		free(data->trash_memory);
+		data->trash_memory = next;
+	}
+}
+
+void	free_trash_list(t_trash_memory *list)
+{
+	t_trash_memory	*next;
+
+	while (list)
+	{
+		next = list->next;
+		free(list->add);
+		free(list);
+		list = next;
+	}
+}
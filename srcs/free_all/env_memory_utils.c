@@ -0,0 +1,72 @@
+#include "../../include/minishell.h"
+
+/*
+	Deplace le maillon de add d'une liste a l'autre sans rien liberer. La
+	recherche s'arrete a stop : les allocations de la ligne en cours sont
+	en tete. Absente (deja deplacee, ou d'avant la ligne), rien ne bouge.
+*/
+bool	move_trash_node(t_trash_memory **from, t_trash_memory **to, \
+void *add, t_trash_memory *stop)
+{
+	t_trash_memory	*tmp;
+	t_trash_memory	*prev;
+
+	tmp = *from;
+	prev = NULL;
+	while (tmp && tmp != stop && tmp->add != add)
+	{
+		prev = tmp;
+		tmp = tmp->next;
+	}
+	if (!tmp || tmp == stop)
+		return (FALSE);
+	if (prev)
+		prev->next = tmp->next;
+	else
+		*from = tmp->next;
+	tmp->next = *to;
+	*to = tmp;
+	return (TRUE);
+}
+
+bool	is_env_value_in_use(t_exec *utils, char *value)
+{
+	t_env		*env;
+	t_export	*export;
+	int			id;
+
+	env = utils->linked_list_full_env_var_copy_alpha;
+	while (env && env->var_env_name_and_value != value)
+		env = env->next_var_env_name_and_value;
+	if (env)
+		return (TRUE);
+	export = utils->head_of_linked_list_env_var;
+	while (export && export->env_var_name_and_value != value)
+		export = export->next_env_var_name_and_value;
+	if (export || utils->logical_pwd.buffer == value)
+		return (TRUE);
+	id = ZERO_INIT;
+	while (id < ENV_HOT_NB)
+	{
+		if (utils->hot_entries[id].buffer == value)
+			return (TRUE);
+		id++;
+	}
+	return (FALSE);
+}
+
+/*
+	Fait pointer slot sur value, qui passe a l'environnement ; l'ancienne
+	valeur est rendue a la ligne si plus rien n'y pointe.
+*/
+void	replace_env_value(t_data *data, char **slot, char *value)
+{
+	char	*old;
+
+	old = *slot;
+	*slot = value;
+	if (old == value)
+		return ;
+	keep_env_memory(data, value);
+	release_env_value(data, old);
+}
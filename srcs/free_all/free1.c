@@ -9,28 +9,26 @@ int	ft_exit_child(int *fd, t_data *data)
 		closes_ends_of_pipe(fd);
 	close_file_descriptors_in_linked_list(data);
 	ft_free_all(data);
-	exit(return_value);
+	exit_shell_process(data, return_value);
+	return (return_value);
 }
 
+/*
+	Ajout en tete de liste : O(1) quelle que soit la taille de la liste.
+	Un ajout en queue la parcourait a chaque malloc_track, ce qui rendait
+	les longues sessions quadratiques. L'ordre n'a pas d'importance pour
+	ft_free_all, et ft_free retrouve plus vite les allocations recentes.
+*/
 void	add_to_trash_memory(t_data *data, void *add)
 {
 	t_trash_memory	*mem;
-	t_trash_memory	*tmp;
 
 	mem = malloc(sizeof(t_trash_memory));
 	if (!mem)
 		return ;
 	mem->add = add;
-	mem->next = NULL;
-	if (data->trash_memory == NULL)
-		data->trash_memory = mem;
-	else
-	{
-		tmp = data->trash_memory;
-		while (tmp->next)
-			tmp = tmp->next;
-		tmp->next = mem;
-	}
+	mem->next = data->trash_memory;
+	data->trash_memory = mem;
 }
 
 void	*malloc_track(t_data *data, size_t size)
@@ -40,6 +38,7 @@ void	*malloc_track(t_data *data, size_t size)
 	add = malloc(size);
 	if (!add)
 		return (NULL);
+	count_shell_stat(STAT_ALLOC);
 	add_to_trash_memory(data, add);
 	return (add);
 }
@@ -57,8 +56,8 @@ void	ft_free(void *add, t_data *data)
 		next = tmp->next;
 		if (tmp->add == add)
 		{
-			tmp->add = NULL;
 			free(tmp->add);
+			tmp->add = NULL;
 			free(tmp);
 			if (ex)
 				ex->next = next;
@@ -73,16 +72,10 @@ void	ft_free(void *add, t_data *data)
 
 void	ft_free_all(t_data *data)
 {
-	t_trash_memory	*tmp;
-	t_trash_memory	*next;
-
-	tmp = data->trash_memory;
-	while (tmp)
-	{
-		next = tmp->next;
-		if (tmp->add)
-			free(tmp->add);
-		free(tmp);
-		tmp = next;
-	}
+	free_env_index(data->utils);
+	ft_reader_free(&data->input.reader);
+	free(data->history.last_line);
+	data->history.last_line = NULL;
+	free_trash_list(data->env_memory);
+	free_trash_list(data->trash_memory);
 }
@@ -0,0 +1,79 @@
+#include "../../include/minishell.h"
+
+/*
+	Les commandes readline liees aux fleches n'ont pas d'argument : on
+	garde ici l'adresse de l'historique du shell pour qu'elles le trouvent.
+*/
+t_history	*get_history(t_history *history)
+{
+	static t_history	*current;
+
+	if (history)
+		current = history;
+	return (current);
+}
+
+int	get_history_size(t_data *data)
+{
+	char	*value;
+	int		i;
+
+	value = get_env_var_value(data, ENV_HISTSIZE);
+	if (!value || !value[0])
+		return (HISTORY_DEFAULT_SIZE);
+	i = ZERO_INIT;
+	while (value[i])
+	{
+		if (!is_decimal_digit(value[i]) || i > 6)
+			return (HISTORY_DEFAULT_SIZE);
+		i++;
+	}
+	return ((int)ft_atoll(value));
+}
+
+char	*get_history_path(t_data *data)
+{
+	char	*value;
+
+	value = get_env_var_value(data, ENV_HISTFILE);
+	if (value && value[0])
+		return (ft_strdup(data, value));
+	value = get_env_var_value(data, ENV_USER_HOME_DIR);
+	if (!value || !value[0])
+		return (NULL);
+	return (ft_strjoin2_mini(value, HISTORY_DEFAULT_FILE, data));
+}
+
+/*
+	Historique borne a MINISHELL_HISTSIZE entrees (500 par defaut). Le
+	fichier n'est pas lu au demarrage : il ne l'est qu'au premier acces
+	a l'historique (fleche haut, CTRL-P ou CTRL-R).
+*/
+void	init_history(t_data *data)
+{
+	data->history.is_loaded = FALSE;
+	data->history.fd = FAIL;
+	data->history.last_line = NULL;
+	data->history.max_size = get_history_size(data);
+	data->history.path = get_history_path(data);
+	get_history(&data->history);
+	stifle_history(data->history.max_size);
+	rl_bind_keyseq("\\e[A", &history_lazy_previous);
+	rl_bind_keyseq("\\eOA", &history_lazy_previous);
+	rl_bind_key(CTRL_P_KEY, &history_lazy_previous);
+	rl_bind_key(CTRL_R_KEY, &history_lazy_search);
+}
+
+/*
+	Ignore les lignes vides et la repetition de la commande precedente,
+	puis ajoute la ligne en memoire et a la fin du fichier.
+*/
+void	record_history_line(t_data *data, char *line)
+{
+	if (!line || is_blank_history_line(line) \
+	|| is_duplicate_history_line(&data->history, line))
+		return ;
+	add_history(line);
+	remember_history_line(&data->history, line);
+	append_history_line(&data->history, line);
+}
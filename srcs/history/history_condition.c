@@ -0,0 +1,13 @@
+#include "../../include/minishell.h"
+
+bool	is_blank_history_line(char *line)
+{
+	while (*line == ' ' || *line == '\t')
+		line++;
+	return (*line == '\0');
+}
+
+bool	is_duplicate_history_line(t_history *history, char *line)
+{
+	return (history->last_line && !strcmp(history->last_line, line));
+}
@@ -0,0 +1,73 @@
+#include "../../include/minishell.h"
+
+/*
+	Ajoute la commande a la fin du fichier d'historique : un seul writev
+	par commande, jamais de reecriture du fichier. Le fichier est ouvert
+	en O_APPEND a la premiere commande.
+*/
+void	append_history_line(t_history *history, char *line)
+{
+	struct iovec	iov[2];
+
+	if (!history->path)
+		return ;
+	if (history->fd == FAIL)
+		history->fd = open(history->path, history_file_flags(), PERM_O_RW);
+	if (history->fd == FAIL)
+		return ;
+	iov[0].iov_base = line;
+	iov[0].iov_len = strlen(line);
+	iov[1].iov_base = "\n";
+	iov[1].iov_len = 1;
+	if (writev(history->fd, iov, 2) < 0)
+	{
+		close(history->fd);
+		history->fd = FAIL;
+		history->path = NULL;
+	}
+}
+
+void	remember_history_line(t_history *history, char *line)
+{
+	free(history->last_line);
+	history->last_line = strdup(line);
+}
+
+/*
+	Premier acces a l'historique : on repart du fichier, qui contient deja
+	les commandes de cette session puisqu'elles y sont ajoutees au fil de
+	l'eau. stifle_history ne garde que les max_size dernieres.
+*/
+void	load_history_file(t_history *history)
+{
+	t_reader	reader;
+	int			fd;
+
+	history->is_loaded = TRUE;
+	if (!history->path)
+		return ;
+	fd = open(history->path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0 || ft_reader_init(&reader, fd) == FT_READER_ERROR)
+		return ;
+	clear_history();
+	free(history->last_line);
+	history->last_line = NULL;
+	read_history_file_lines(history, &reader);
+	ft_reader_free(&reader);
+	close(fd);
+	using_history();
+}
+
+int	history_lazy_previous(int count, int key)
+{
+	if (!get_history(NULL)->is_loaded)
+		load_history_file(get_history(NULL));
+	return (rl_get_previous_history(count, key));
+}
+
+int	history_lazy_search(int count, int key)
+{
+	if (!get_history(NULL)->is_loaded)
+		load_history_file(get_history(NULL));
+	return (rl_reverse_search_history(count, key));
+}
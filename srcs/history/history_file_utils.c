@@ -0,0 +1,17 @@
+#include "../../include/minishell.h"
+
+void	read_history_file_lines(t_history *history, t_reader *reader)
+{
+	char	*line;
+	size_t	len;
+
+	while (ft_reader_next_line(reader, &line, &len) == FT_READER_LINE)
+	{
+		if (!is_blank_history_line(line) \
+		&& !is_duplicate_history_line(history, line))
+		{
+			add_history(line);
+			remember_history_line(history, line);
+		}
+	}
+}
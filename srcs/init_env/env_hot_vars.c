@@ -0,0 +1,83 @@
+#include "../../include/minishell.h"
+
+/*
+	Variables chaudes : PWD, OLDPWD et HOME, lues et ecrites a chaque cd.
+	L'index garde un pointeur direct sur leur noeud, rafraichi a chaque
+	reconstruction : tant qu'aucun export ni unset ne perime l'index, cd
+	y accede sans rien parcourir.
+*/
+char	*get_env_hot_name(int id)
+{
+	if (id == ENV_HOT_PWD)
+		return (ENV_CURRENT_WORKING_DIR);
+	if (id == ENV_HOT_OLDPWD)
+		return (ENV_PREVIOUS_WORKING_DIR);
+	return (ENV_USER_HOME_DIR);
+}
+
+t_env	*probe_env_index(t_env_index *index, const char *name, size_t len)
+{
+	size_t	slot;
+
+	slot = hash_env_name(name, len) & (index->capacity - 1);
+	while (index->slots[slot])
+	{
+		if (is_env_entry_named(index->slots[slot], name, len))
+			return (index->slots[slot]);
+		slot = (slot + 1) & (index->capacity - 1);
+	}
+	return (NULL);
+}
+
+void	refresh_env_hot_vars(t_env_index *index)
+{
+	int		id;
+	char	*name;
+
+	id = ZERO_INIT;
+	while (id < ENV_HOT_NB)
+	{
+		name = get_env_hot_name(id);
+		index->hot_vars[id] = probe_env_index(index, name, ft_strlen(name));
+		id++;
+	}
+}
+
+t_env	*get_env_hot_var(t_data *data, int id)
+{
+	char	*name;
+
+	if (data->utils->env_index.is_stale \
+	&& rebuild_env_index(data->utils) == FAIL)
+	{
+		name = get_env_hot_name(id);
+		return (find_env_var_linear(data->utils, name, ft_strlen(name)));
+	}
+	return (data->utils->env_index.hot_vars[id]);
+}
+
+/*
+	Agrandit le tampon par puissances de deux. Le nouveau appartient a
+	l'environnement ; l'ancien est rendu a la ligne et non libere tout de
+	suite : un tableau d'environnement deja construit peut encore pointer
+	dessus.
+*/
+int	reserve_hot_entry(t_data *data, t_hot_entry *entry, size_t size)
+{
+	size_t	capacity;
+	char	*buffer;
+
+	if (size <= entry->capacity)
+		return (TRUE);
+	capacity = ENV_HOT_MIN_CAPACITY;
+	while (capacity < size)
+		capacity *= 2;
+	buffer = malloc_track(data, capacity);
+	if (!buffer)
+		return (FALSE);
+	keep_env_memory(data, buffer);
+	drop_env_memory(data, entry->buffer);
+	entry->buffer = buffer;
+	entry->capacity = capacity;
+	return (TRUE);
+}
@@ -0,0 +1,60 @@
+#include "../../include/minishell.h"
+
+void	init_hot_entries(t_exec *utils)
+{
+	int	id;
+
+	id = ZERO_INIT;
+	while (id < ENV_HOT_NB)
+	{
+		utils->env_index.hot_vars[id] = NULL;
+		utils->hot_entries[id].buffer = NULL;
+		utils->hot_entries[id].capacity = ZERO_INIT;
+		id++;
+	}
+	utils->logical_pwd.buffer = NULL;
+	utils->logical_pwd.capacity = ZERO_INIT;
+}
+
+char	*find_env_hot_value(t_data *data, int id)
+{
+	t_env	*env;
+	size_t	len;
+
+	env = get_env_hot_var(data, id);
+	if (!env)
+		return (NULL);
+	len = ft_strlen(get_env_hot_name(id));
+	if (env->var_env_name_and_value[len] != '=')
+		return (NULL);
+	return (env->var_env_name_and_value + len + 1);
+}
+
+/*
+	Reecrit "NOM=valeur" dans le tampon propre a la variable et y fait
+	pointer son noeud : pas de parcours ni de nouvelle chaine a chaque cd.
+	Comme cd jusqu'ici, une variable absente n'est pas recreee.
+*/
+int	set_env_hot_value(t_data *data, int id, const char *value)
+{
+	t_env		*env;
+	t_hot_entry	*entry;
+	char		*name;
+	size_t		name_len;
+	size_t		value_len;
+
+	env = get_env_hot_var(data, id);
+	if (!env)
+		return (FALSE);
+	entry = &data->utils->hot_entries[id];
+	name = get_env_hot_name(id);
+	name_len = ft_strlen(name);
+	value_len = strlen(value);
+	if (!reserve_hot_entry(data, entry, name_len + value_len + 2))
+		return (FALSE);
+	memcpy(entry->buffer, name, name_len);
+	entry->buffer[name_len] = '=';
+	memcpy(entry->buffer + name_len + 1, value, value_len + 1);
+	replace_env_value(data, &env->var_env_name_and_value, entry->buffer);
+	return (TRUE);
+}
@@ -0,0 +1,92 @@
+#include "../../include/minishell.h"
+
+/*
+	Index des variables d'environnement : table de hachage a adressage
+	ouvert (nom -> noeud de la liste chainee). La liste reste la source de
+	verite ; toute insertion ou suppression marque l'index perime et il
+	est reconstruit a la recherche suivante. Les modifications de valeur
+	sur un noeud existant ne le perime pas, la valeur etant lue dans le
+	noeud au moment de la recherche.
+*/
+void	mark_env_index_stale(t_exec *utils)
+{
+	if (utils)
+		utils->env_index.is_stale = TRUE;
+}
+
+size_t	hash_env_name(const char *name, size_t len)
+{
+	size_t	hash;
+	size_t	i;
+
+	hash = ENV_INDEX_FNV_OFFSET;
+	i = ZERO_INIT;
+	while (i < len)
+	{
+		hash ^= (unsigned char)name[i++];
+		hash *= ENV_INDEX_FNV_PRIME;
+	}
+	return (hash);
+}
+
+/*
+	En cas de doublon dans la liste, le premier noeud garde la place,
+	comme le faisait le parcours lineaire.
+*/
+void	insert_env_index_slot(t_env_index *index, t_env *env)
+{
+	size_t	len;
+	size_t	slot;
+
+	len = env_entry_name_length(env->var_env_name_and_value);
+	slot = hash_env_name(env->var_env_name_and_value, len) \
+	& (index->capacity - 1);
+	while (index->slots[slot])
+	{
+		if (is_env_entry_named(index->slots[slot], \
+		env->var_env_name_and_value, len))
+			return ;
+		slot = (slot + 1) & (index->capacity - 1);
+	}
+	index->slots[slot] = env;
+}
+
+bool	grow_env_index(t_env_index *index, size_t capacity)
+{
+	free(index->slots);
+	index->slots = malloc(sizeof(t_env *) * capacity);
+	if (!index->slots)
+	{
+		index->capacity = ZERO_INIT;
+		return (false);
+	}
+	index->capacity = capacity;
+	return (true);
+}
+
+int	rebuild_env_index(t_exec *utils)
+{
+	t_env_index	*index;
+	t_env		*env;
+	size_t		count;
+	size_t		capacity;
+
+	index = &utils->env_index;
+	count = count_env_vars(utils->linked_list_full_env_var_copy_alpha);
+	capacity = ENV_INDEX_MIN_CAPACITY;
+	while (capacity < count * 2)
+		capacity *= 2;
+	if (capacity > index->capacity && !grow_env_index(index, capacity))
+		return (FAIL);
+	ft_memset(index->slots, 0, sizeof(t_env *) * index->capacity);
+	env = utils->linked_list_full_env_var_copy_alpha;
+	while (env)
+	{
+		if (env->var_env_name_and_value)
+			insert_env_index_slot(index, env);
+		env = env->next_var_env_name_and_value;
+	}
+	refresh_env_hot_vars(index);
+	index->is_stale = FALSE;
+	return (ZERO_INIT);
+}
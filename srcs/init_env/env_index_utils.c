@@ -0,0 +1,50 @@
+#include "../../include/minishell.h"
+
+/*
+	Parcours lineaire de secours, si l'index n'a pas pu etre alloue.
+*/
+t_env	*find_env_var_linear(t_exec *utils, const char *name, size_t len)
+{
+	t_env	*env;
+
+	env = utils->linked_list_full_env_var_copy_alpha;
+	while (env)
+	{
+		if (env->var_env_name_and_value \
+		&& is_env_entry_named(env, name, len))
+			return (env);
+		env = env->next_var_env_name_and_value;
+	}
+	return (NULL);
+}
+
+void	init_env_index(t_exec *utils)
+{
+	utils->env_index.slots = NULL;
+	utils->env_index.capacity = ZERO_INIT;
+	utils->env_index.is_stale = TRUE;
+}
+
+/*
+	La table est allouee avec malloc (et non malloc_track) pour pouvoir
+	etre remplacee a chaque agrandissement sans s'accumuler dans la
+	trash_memory ; elle est liberee ici, depuis ft_free_all.
+*/
+void	free_env_index(t_exec *utils)
+{
+	if (!utils)
+		return ;
+	free(utils->env_index.slots);
+	utils->env_index.slots = NULL;
+	utils->env_index.capacity = ZERO_INIT;
+}
+
+size_t	count_env_vars(t_env *env)
+{
+	size_t	count;
+
+	count = ZERO_INIT;
+	while (env && ++count)
+		env = env->next_var_env_name_and_value;
+	return (count);
+}
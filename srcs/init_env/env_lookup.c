@@ -0,0 +1,57 @@
+#include "../../include/minishell.h"
+
+size_t	env_entry_name_length(const char *entry)
+{
+	size_t	len;
+
+	len = ZERO_INIT;
+	while (entry[len] && entry[len] != '=')
+		len++;
+	return (len);
+}
+
+bool	is_env_entry_named(t_env *env, const char *name, size_t len)
+{
+	return (!ft_strncmp(env->var_env_name_and_value, name, len) \
+	&& (env->var_env_name_and_value[len] == '=' \
+	|| env->var_env_name_and_value[len] == '\0'));
+}
+
+/*
+	Cherche la variable 'name' (len octets, pas forcement termine par
+	'\0') dans l'environnement courant via l'index, reconstruit si besoin.
+*/
+t_env	*find_env_var(t_data *data, const char *name, size_t len)
+{
+	t_env_index	*index;
+
+	if (!data->utils || !len)
+		return (NULL);
+	index = &data->utils->env_index;
+	if (index->is_stale && rebuild_env_index(data->utils) == FAIL)
+		return (find_env_var_linear(data->utils, name, len));
+	return (probe_env_index(index, name, len));
+}
+
+/*
+	Renvoie la valeur (apres le '=') de la variable, ou NULL si elle est
+	absente ou sans valeur.
+*/
+char	*find_env_value(t_data *data, const char *name, size_t len)
+{
+	t_env	*env;
+
+	env = find_env_var(data, name, len);
+	if (!env || env->var_env_name_and_value[len] != '=')
+		return (NULL);
+	return (env->var_env_name_and_value + len + 1);
+}
+
+/*
+	Renvoie la valeur de la variable 'name' dans l'environnement courant
+	(liste chainee, donc exports et unsets compris), ou NULL si absente.
+*/
+char	*get_env_var_value(t_data *data, char *name)
+{
+	return (find_env_value(data, name, ft_strlen(name)));
+}
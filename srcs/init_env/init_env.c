@@ -52,10 +52,19 @@ t_exec	*init_env(t_data *data, char **env)
 	if (!utils)
 		return (NULL);
 	utils->linked_list_full_env_var_copy_alpha = NULL;
+	init_env_index(utils);
+	init_hot_entries(utils);
 	if (env)
 		utils->linked_list_full_env_var_copy_alpha = \
 		create_env_list_from_array(data, env);
 	utils->head_env_lst = utils->linked_list_full_env_var_copy_alpha;
+	init_logical_pwd(data, utils);
+	utils->cmd_subst.buffer = NULL;
+	utils->cmd_subst.len = ZERO_INIT;
+	utils->cmd_subst.capacity = ZERO_INIT;
 	utils->is_this_an_exec_in_heredoc = ZERO_INIT;
+	utils->time_report.is_pipeline_timed = FALSE;
+	utils->trace.fd = FAIL;
+	init_shell_stats();
 	return (utils);
 }
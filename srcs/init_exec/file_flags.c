@@ -10,7 +10,7 @@ int	append_to_file_flags(void)
 	return (O_CREAT | O_RDWR | O_APPEND);
 }
 
-int	heredoc_tmp_file_flags(void)
+int	history_file_flags(void)
 {
-	return (O_CREAT | O_WRONLY | O_TRUNC);
+	return (O_CREAT | O_WRONLY | O_APPEND | O_CLOEXEC);
 }
@@ -1,100 +1,64 @@
 #include "../../include/minishell.h"
 
-char	*extract_and_get_var_value(char **line, int var_name_start,
-int var_name_length, t_data *data)
-{
-	char	*var_name;
-	char	*value;
-
-	var_name = malloc(sizeof(char *) * (var_name_length + 1));
-	if (!var_name)
-		return (NULL);
-	ft_strncpy(var_name, *line + var_name_start, var_name_length);
-	var_name[var_name_length] = '\0';
-	value = get_variable_value(var_name, data);
-	free (var_name);
-	return (value);
-}
-
-int	get_var_name_length(char *line, int start)
-{
-	int	length;
-
-	length = 0;
-	while (line[start + length] && is_valid_variable_char(line[start + length]))
-		length++;
-	return (length);
-}
-
-void	expand_variable(char **line, int index, t_data *data)
-{
-	int		var_name_start;
-	int		var_name_length;
-	int		new_line_length;
-	char	*new_line;
-	char	*var_value;
-
-	var_name_start = index + 1;
-	var_name_length = get_var_name_length(*line, var_name_start);
-	if (var_name_length == 0)
-		return ;
-	var_value = extract_and_get_var_value(line, var_name_start,
-			var_name_length, data);
-	if (!var_value)
-		var_value = "";
-	new_line_length = strlen2(*line) - var_name_length - 1 + strlen2(var_value);
-	new_line = malloc(new_line_length + 1);
-	if (!new_line)
-		return ;
-	ft_strncpy(new_line, *line, index);
-	ft_strcpy(new_line + index, var_value);
-	ft_strcpy(new_line + index + strlen2(var_value), *line + var_name_start
-		+ var_name_length);
-	free (*line);
-	*line = new_line;
-}
-
 /*
-	Traite une ligne lue dans un heredoc pour l'expansion des variables et
-	la gestion des échappements.
+	Developpe une ligne de here_doc en un seul passage, directement dans
+	le tampon du here_doc : les morceaux sans '$' ni '\' sont copies d'un
+	bloc et chaque variable est cherchee sans recopier la ligne ni son nom.
+	Comme dans bash, '\' n'echappe que '$', '`' et '\'.
 */
-void	process_heredoc_line(char **line, t_data *data)
+void	expand_heredoc_line(char *line, t_data *data, t_heredoc_sink *sink)
 {
-	int	i;
+	size_t	start;
+	size_t	i;
 
-	i = 0;
-	while ((*line)[i])
+	start = ZERO_INIT;
+	i = ZERO_INIT;
+	while (line[i])
 	{
-		if ((*line)[i] == '$' && !is_escaped(*line, i))
-			expand_variable(line, i, data);
-		else if (is_escaped(*line, i))
-			remove_escape_character(line, i);
-		i++;
+		if (line[i] == '\\' && is_heredoc_escapable_char(line[i + 1]))
+		{
+			append_heredoc_sink(sink, line + start, i - start);
+			start = ++i;
+			i++;
+		}
+		else if (line[i] == '$' && is_heredoc_expansion_start(line[i + 1]))
+		{
+			append_heredoc_sink(sink, line + start, i - start);
+			i = append_heredoc_variable(line, i + 1, data, sink);
+			start = i;
+		}
+		else
+			i++;
 	}
+	append_heredoc_sink(sink, line + start, i - start);
+	append_heredoc_sink(sink, "\n", 1);
+	sink->total_lines++;
 }
 
-void	ft_read_input(t_node *node, t_lexer *lexer_lst, t_data *data)
+/*
+	Lit un corps de here_doc jusqu'au delimiteur ou jusqu'a EOF. Renvoie
+	FALSE si la lecture a ete interrompue par CTRL-C (stdin ferme par le
+	gestionnaire de signal), TRUE sinon.
+*/
+int	ft_read_input(t_lexer *lexer_lst, t_data *data, t_heredoc_sink *sink)
 {
 	char	*line;
 
-	data->utils->stdin_fd_for_heredoc = dup(0);
 	while (INFINITY_LOOP)
 	{
-		line = readline("> ");
-		if (line == NULL && data->utils->heredoc_ctrl_c_uninterrupted)
-		{
-			dup2(data->utils->stdin_fd_for_heredoc, STDIN_FILENO);
-			break ;
-		}
-		if (is_heredoc_delimiter_matched(lexer_lst->next->cmd_segment, line))
+		line = read_input_line(data, HEREDOC_PROMPT);
+		if (is_heredoc_interrupted_by_signal(line))
+			return (FALSE);
+		if (line == NULL \
+		|| is_heredoc_delimiter_matched(lexer_lst->next->cmd_segment, line))
 		{
 			free(line);
-			break ;
+			return (TRUE);
 		}
-		process_heredoc_line(&line, data);
-		write_line_to_heredoc(line, node->here_doc_fd);
+		if (lexer_lst->next->is_delimiter_quoted)
+			write_line_to_heredoc(line, sink);
+		else
+			expand_heredoc_line(line, data, sink);
 		free(line);
 	}
-	close(data->utils->stdin_fd_for_heredoc);
-	free(data->utils->heredoc_input_buffer);
 }
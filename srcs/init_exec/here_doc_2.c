@@ -1,65 +1,52 @@
 #include "../../include/minishell.h"
 
-void	write_line_to_heredoc(char *line, int heredoc_fd)
+void	write_line_to_heredoc(char *line, t_heredoc_sink *sink)
 {
-	ft_write_fd(line, heredoc_fd);
-	ft_write_fd("\n", heredoc_fd);
+	append_heredoc_sink(sink, line, ft_strlen(line));
+	append_heredoc_sink(sink, "\n", 1);
+	sink->total_lines++;
 }
 
-char	*get_variable_value(char *var_name, t_data *data)
+void	append_heredoc_exit_status(t_heredoc_sink *sink)
 {
-	int		i;
-	char	*env_entry;
-	char	*separator;
-	int		name_length;
-
-	i = 0;
-	if (!var_name || !data)
-		return (NULL);
-	while (data->full_env_var_copy_alpha[i] != NULL)
+	char			digits[12];
+	int				i;
+	unsigned int	status;
+
+	status = g_globi;
+	i = sizeof(digits);
+	digits[--i] = '0' + status % 10;
+	while (status >= 10)
 	{
-		env_entry = data->full_env_var_copy_alpha[i];
-		separator = ft_strchr(env_entry, '=');
-		if (!separator)
-			continue ;
-		name_length = separator - env_entry;
-		if (ft_strncmp(var_name, env_entry, name_length) == 0 && \
-			strlen2(var_name) == name_length)
-			return (separator + 1);
-		i++;
+		status /= 10;
+		digits[--i] = '0' + status % 10;
 	}
-	return (NULL);
-}
-
-int	is_backslash_at_end(char *str)
-{
-	int	index;
-
-	index = ZERO_INIT;
-	while (str[index])
-		index++;
-	if (str[--index] == '\\')
-		return (CHAR_IS_DOLLAR);
-	return (CHAR_IS_NOT_DOLLAR);
+	append_heredoc_sink(sink, digits + i, sizeof(digits) - i);
 }
 
-void	remove_escape_character(char **line, int index)
+/*
+	'start' pointe juste apres le '$'. Le nom est cherche tel quel (pointeur
+	et longueur) dans l'index de l'environnement courant, sans allocation.
+	Renvoie l'index qui suit le nom.
+*/
+size_t	append_heredoc_variable(\
+char *line, size_t start, t_data *data, t_heredoc_sink *sink)
 {
-	int	i;
+	size_t	end;
+	char	*value;
 
-	i = index;
-	while ((*line)[i])
+	if (line[start] == '?')
 	{
-		(*line)[i] = (*line)[i + 1];
-		i++;
+		append_heredoc_exit_status(sink);
+		return (start + 1);
 	}
-	(*line)[i] = '\0';
-}
-
-/**
- * Vérifie si le caractère à l'index donné doit être échappé.
- */
-int	is_escaped(char *line, int index)
-{
-	return (index > 0 && line[index - 1] == '\\');
+	if (is_decimal_digit(line[start]))
+		return (start + 1);
+	end = start;
+	while (is_valid_variable_char(line[end]))
+		end++;
+	value = find_env_value(data, line + start, end - start);
+	if (value)
+		append_heredoc_sink(sink, value, ft_strlen(value));
+	return (end);
 }
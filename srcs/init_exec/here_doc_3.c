@@ -1,16 +1,79 @@
 #include "../../include/minishell.h"
 
-void	manage_here_doc_process(t_node *node, t_lexer *lexer_lst, t_data *data)
+bool	is_heredoc_present_in_lexer_list(t_lexer *lexer_lst)
 {
+	while (lexer_lst)
+	{
+		if (is_here_doc_followed_by_delimiter(lexer_lst))
+			return (TRUE);
+		lexer_lst = lexer_lst->next;
+	}
+	return (FALSE);
+}
+
+/*
+	Collecte le corps d'un here_doc dans son propre pipe (ou memfd s'il
+	deborde) et garde le fd de lecture sur le lexeme HERE_DOC, en attendant
+	que le noeud de commande correspondant soit construit.
+*/
+int	collect_heredoc_body(t_lexer *lexer_lst, t_data *data)
+{
+	t_heredoc_sink	*sink;
+	int				is_completed;
+
+	sink = &data->utils->heredoc_sink;
+	if (open_heredoc_sink(sink) < 0)
+	{
+		perror("here-document");
+		lexer_lst->heredoc_fd = INPUT_FD_REDIRECTION_FAIL;
+		return (TRUE);
+	}
+	is_completed = ft_read_input(lexer_lst, data, sink);
+	lexer_lst->heredoc_fd = close_heredoc_sink(sink);
+	trace_heredoc_stats(data, sink);
+	return (is_completed);
+}
+
+void	discard_collected_heredocs(t_lexer *lexer_lst)
+{
+	while (lexer_lst)
+	{
+		if (lexer_lst->heredoc_fd >= 0)
+			close(lexer_lst->heredoc_fd);
+		if (is_here_doc_followed_by_delimiter(lexer_lst))
+			lexer_lst->heredoc_fd = INPUT_FD_REDIRECTION_FAIL;
+		lexer_lst = lexer_lst->next;
+	}
+}
+
+/*
+	Lit tous les here_docs de la ligne avant de construire les noeuds :
+	une seule mise en place des signaux et une seule sauvegarde de stdin
+	pour tout le pipeline. Un CTRL-C abandonne les here_docs restants et
+	la ligne entiere, comme dans bash.
+*/
+void	collect_heredocs_before_exec(t_data *data)
+{
+	t_lexer	*lexer_lst;
+
+	if (!is_heredoc_present_in_lexer_list(data->lexer_list))
+		return ;
+	data->utils->stdin_fd_for_heredoc = dup(STDIN_FILENO);
 	data->utils->is_this_an_exec_in_heredoc = TRUE;
 	handle_sig(data);
-	node->heredoc_tmp_fullname = HEREDOC_TEMP_FILE;
-	node->here_doc_fd = open(\
-	node->heredoc_tmp_fullname, heredoc_tmp_file_flags(), PERM_RWX_ALL);
-	if (is_heredoc_file_opening_failed(node->here_doc_fd))
-		return ;
-	ft_read_input(node, lexer_lst, data);
+	lexer_lst = data->lexer_list;
+	while (lexer_lst)
+	{
+		if (is_here_doc_followed_by_delimiter(lexer_lst) \
+		&& !collect_heredoc_body(lexer_lst, data))
+		{
+			ft_dup2(data->utils->stdin_fd_for_heredoc, STDIN_FILENO);
+			discard_collected_heredocs(data->lexer_list);
+			data->utils->heredoc_ctrl_c_uninterrupted = FALSE;
+			break ;
+		}
+		lexer_lst = lexer_lst->next;
+	}
+	close(data->utils->stdin_fd_for_heredoc);
 	data->utils->is_this_an_exec_in_heredoc = FALSE;
-	handle_sig(data);
-	close(node->here_doc_fd);
 }
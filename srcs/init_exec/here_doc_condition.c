@@ -6,23 +6,22 @@ bool	is_heredoc_delimiter_matched(char *delimiter, char *line)
 	&& (strlen2(delimiter) == strlen2(line)));
 }
 
-bool	is_heredoc_ended_by_signal(t_data *data)
+bool	is_heredoc_interrupted_by_signal(char *line)
 {
-	return (!data->utils->heredoc_input_buffer \
-	&& data->utils->heredoc_ctrl_c_uninterrupted);
+	return (line == NULL && fcntl(STDIN_FILENO, F_GETFD) < 0);
 }
 
-bool	is_heredoc_interrupted_for_stdin_restore(t_data *data)
+bool	is_valid_variable_char(char c)
 {
-	return (!data->utils->heredoc_ctrl_c_uninterrupted);
+	return (ft_isalnum(c) || c == '_');
 }
 
-bool	is_heredoc_file_opening_failed(int file_descriptor)
+bool	is_heredoc_escapable_char(char c)
 {
-	return (file_descriptor < 0);
+	return (c == '$' || c == '`' || c == '\\');
 }
 
-bool	is_valid_variable_char(char c)
+bool	is_heredoc_expansion_start(char c)
 {
-	return (ft_isalnum(c) || c == '_');
+	return (c == '?' || is_valid_variable_char(c));
 }
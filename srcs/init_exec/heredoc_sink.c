@@ -0,0 +1,102 @@
+#define _GNU_SOURCE
+#include <sys/mman.h>
+#include "../../include/minishell.h"
+
+/*
+	Le contenu d'un here_doc part d'abord dans un pipe dont l'extremite
+	d'ecriture est non bloquante : tant qu'il tient dans le tampon du
+	pipe, aucun fichier n'est cree. L'extremite de lecture devient
+	directement l'input_fd du noeud ; les deux sont O_CLOEXEC pour que
+	les commandes lancees n'en heritent pas.
+*/
+int	open_heredoc_sink(t_heredoc_sink *sink)
+{
+	sink->memfd = FAIL;
+	sink->pipe_bytes = ZERO_INIT;
+	sink->has_failed = FALSE;
+	sink->total_bytes = ZERO_INIT;
+	sink->total_lines = ZERO_INIT;
+	sink->buffer_len = ZERO_INIT;
+	if (ft_pipe(sink->pipe_fd, O_CLOEXEC) < 0)
+		return (FAIL);
+	if (fcntl(sink->pipe_fd[PIPE_WRITE_END], F_SETFL, O_NONBLOCK) < 0)
+	{
+		closes_ends_of_pipe(sink->pipe_fd);
+		return (FAIL);
+	}
+	return (ZERO_INIT);
+}
+
+/*
+	Le pipe est plein : on bascule sur un fichier anonyme (memfd_create),
+	sans nom dans le repertoire courant, et on y recopie ce que le pipe
+	contient deja pour garder l'ordre des lignes.
+*/
+int	spill_heredoc_sink_to_memfd(t_heredoc_sink *sink)
+{
+	char	chunk[HEREDOC_SPILL_CHUNK];
+	ssize_t	nread;
+
+	sink->memfd = memfd_create("minishell-heredoc", MFD_CLOEXEC);
+	if (sink->memfd < 0)
+		return (FAIL);
+	while (sink->pipe_bytes > 0)
+	{
+		nread = read(sink->pipe_fd[PIPE_READ_END], chunk, sizeof(chunk));
+		if (nread <= 0
+			|| write_all_to_fd(sink->memfd, chunk, nread) < 0)
+			return (FAIL);
+		sink->pipe_bytes -= nread;
+	}
+	closes_ends_of_pipe(sink->pipe_fd);
+	sink->pipe_fd[PIPE_READ_END] = FAIL;
+	sink->pipe_fd[PIPE_WRITE_END] = FAIL;
+	return (ZERO_INIT);
+}
+
+void	write_heredoc_sink(t_heredoc_sink *sink, const char *buf, size_t len)
+{
+	ssize_t	written;
+
+	if (sink->has_failed)
+		return ;
+	if (sink->memfd < 0)
+	{
+		written = write_heredoc_sink_pipe(sink, buf, len);
+		if (written == (ssize_t)len)
+			return ;
+		if (written == FAIL || spill_heredoc_sink_to_memfd(sink) < 0)
+		{
+			sink->has_failed = TRUE;
+			return ;
+		}
+		buf += written;
+		len -= written;
+	}
+	if (write_all_to_fd(sink->memfd, buf, len) < 0)
+		sink->has_failed = TRUE;
+}
+
+/*
+	Vide le tampon puis renvoie le fd a lire pour l'entree de la commande :
+	la fin de lecture du pipe, ou le memfd rembobine. En cas d'echec tout
+	est ferme.
+*/
+int	close_heredoc_sink(t_heredoc_sink *sink)
+{
+	flush_heredoc_sink(sink);
+	if (!sink->has_failed && sink->memfd >= 0
+		&& lseek(sink->memfd, 0, SEEK_SET) == 0)
+		return (sink->memfd);
+	if (!sink->has_failed && sink->memfd < 0)
+	{
+		close(sink->pipe_fd[PIPE_WRITE_END]);
+		return (sink->pipe_fd[PIPE_READ_END]);
+	}
+	perror("here-document");
+	if (sink->memfd >= 0)
+		close(sink->memfd);
+	if (sink->pipe_fd[PIPE_READ_END] >= 0)
+		closes_ends_of_pipe(sink->pipe_fd);
+	return (INPUT_FD_REDIRECTION_FAIL);
+}
@@ -0,0 +1,60 @@
+#include "../../include/minishell.h"
+
+int	write_all_to_fd(int fd, const char *buf, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = ft_write(fd, buf, len);
+		if (written < 0)
+			return (FAIL);
+		buf += written;
+		len -= written;
+	}
+	return (ZERO_INIT);
+}
+
+/*
+	Ecrit ce qui tient dans le pipe sans bloquer et renvoie le nombre
+	d'octets acceptes (0 si le pipe est plein), ou FAIL sur erreur.
+*/
+ssize_t	write_heredoc_sink_pipe(\
+t_heredoc_sink *sink, const char *buf, size_t len)
+{
+	ssize_t	written;
+
+	written = ft_write(sink->pipe_fd[PIPE_WRITE_END], buf, len);
+	if (written < 0 && errno != EAGAIN)
+		return (FAIL);
+	if (written < 0)
+		written = ZERO_INIT;
+	sink->pipe_bytes += written;
+	return (written);
+}
+
+void	flush_heredoc_sink(t_heredoc_sink *sink)
+{
+	if (sink->buffer_len)
+		write_heredoc_sink(sink, sink->buffer, sink->buffer_len);
+	sink->buffer_len = ZERO_INIT;
+}
+
+/*
+	Accumule le corps du here_doc dans un tampon de 64 Kio vide d'un seul
+	write quand il est plein, au lieu de deux write par ligne.
+	Un morceau plus grand que le tampon est ecrit directement.
+*/
+void	append_heredoc_sink(t_heredoc_sink *sink, const char *buf, size_t len)
+{
+	sink->total_bytes += len;
+	if (sink->buffer_len + len > HEREDOC_BUFFER_SIZE)
+		flush_heredoc_sink(sink);
+	if (len >= HEREDOC_BUFFER_SIZE)
+	{
+		write_heredoc_sink(sink, buf, len);
+		return ;
+	}
+	memcpy(sink->buffer + sink->buffer_len, buf, len);
+	sink->buffer_len += len;
+}
@@ -31,7 +31,7 @@ void	build_cmd_linked_list(t_node *node, t_data *data, t_exec *utils)
 		node = malloc_track(data, sizeof(t_node));
 		if (!node)
 			return ;
-		setup_input_redirection(node, data->lexer_list, data);
+		setup_input_redirection(node, data->lexer_list);
 		setup_output_redirection(node, data->lexer_list);
 		node->next = NULL;
 		node->is_command_present = is_token_type_cmd(data->lexer_list);
@@ -55,10 +55,7 @@ void	ft_init_exec(t_data *data)
 	t_node	*node;
 
 	data->utils->node = NULL;
-	data->utils->is_this_an_exec_in_heredoc = 1;
 	data->utils->heredoc_ctrl_c_uninterrupted = 1;
-	data->utils->heredoc_nbr = 0;
-	data->utils->heredoc_input_buffer = NULL;
 	data->utils->nb_cmd_in_lst = \
 	count_cmd_in_lexer_linked_list(data->lexer_list);
 	data->utils->cmd_nb_pipe = \
@@ -72,6 +69,7 @@ void	ft_init_exec(t_data *data)
 		data, data->utils->head_of_linked_list_env_var);
 		export_quotes(data->utils->head_of_linked_list_env_var, data);
 	}
+	collect_heredocs_before_exec(data);
 	node = NULL;
 	build_cmd_linked_list(node, data, data->utils);
 	data->utils->is_this_an_exec_in_heredoc = ZERO_INIT;
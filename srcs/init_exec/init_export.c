@@ -48,6 +48,8 @@ t_data *data, t_export *new)
 	data, data->utils->linked_list_full_env_var_copy_alpha->\
 	var_env_name_and_value);
 	new->next_env_var_name_and_value = NULL;
+	keep_env_memory(data, new);
+	keep_env_memory(data, new->env_var_name_and_value);
 	return (new);
 }
 
@@ -1,6 +1,6 @@
 #include "../../include/minishell.h"
 
-void	setup_input_redirection(t_node *node, t_lexer *lexer_lst, t_data *data)
+void	setup_input_redirection(t_node *node, t_lexer *lexer_lst)
 {
 	node->input_fd = INPUT_FD_NOT_SET;
 	node->is_input_redirection_failed = ZERO_INIT;
@@ -13,11 +13,12 @@ void	setup_input_redirection(t_node *node, t_lexer *lexer_lst, t_data *data)
 			if (is_next_word_missing(lexer_lst))
 				node->is_input_redirection_failed = TRUE;
 			if (is_next_word_existing_and_readable(lexer_lst))
-				node->input_fd = open(lexer_lst->next->cmd_segment, O_RDONLY);
+				node->input_fd = ft_open(\
+				lexer_lst->next->cmd_segment, O_RDONLY, 0);
 			else
 				handle_redirect_input_error(node, lexer_lst);
 		}
-		configure_here_doc_input(node, lexer_lst, data);
+		configure_here_doc_input(node, lexer_lst);
 		lexer_lst = lexer_lst->next;
 	}
 }
@@ -30,7 +31,7 @@ t_node *node, t_lexer *lex_lst, int *is_output_redirection_feasible)
 		if (is_output_fd_open_for_closing(node))
 			close (node->output_fd);
 		if (is_next_lexeme_word_existing(lex_lst))
-			node->output_fd = open(\
+			node->output_fd = ft_open(\
 			lex_lst->next->cmd_segment, append_to_file_flags(), \
 			PERM_O_RW_G_R_OT_R);
 		else
@@ -58,7 +59,7 @@ void	normal_output_redirection(t_node *node, t_lexer *lex_lst)
 		if (is_output_fd_open_for_closing(node))
 			close (node->output_fd);
 		if (is_next_command_segment_present(lex_lst))
-			node->output_fd = open(\
+			node->output_fd = ft_open(\
 			lex_lst->next->cmd_segment, out_to_file_flags(), \
 			PERM_O_RW_G_R_OT_R);
 		else
@@ -29,7 +29,7 @@ t_node *node, t_lexer *lex_lst)
 	return (node->output_redirection_error_id != \
 	OUTPUT_ABSENCE_OF_TARGET_ERROR_CODE \
 	&& (node->output_fd == OUTPUT_FD_NOT_CONFIGURED \
-	|| !access(lex_lst->next->cmd_segment, W_OK)));
+	|| !ft_access(lex_lst->next->cmd_segment, W_OK)));
 }
 
 bool	is_output_append_redirection_error_detected(\
@@ -38,5 +38,5 @@ t_node *node, t_lexer *lex_lst)
 	return (node->output_redirection_error_id != \
 	OUTPUT_ABSENCE_OF_TARGET_ERROR_CODE \
 	&& (node->output_fd == OUTPUT_FD_NOT_CONFIGURED \
-	|| !access(lex_lst->next->cmd_segment, F_OK)));
+	|| !ft_access(lex_lst->next->cmd_segment, F_OK)));
 }
@@ -4,7 +4,7 @@ bool	is_next_word_existing_and_readable(t_lexer *lexer_lst)
 {
 	return (lexer_lst->next \
 	&& lexer_lst->next->cmd_segment \
-	&& !access(lexer_lst->next->cmd_segment, R_OK));
+	&& !ft_access(lexer_lst->next->cmd_segment, R_OK));
 }
 
 bool	is_next_word_missing(t_lexer *lexer_lst)
@@ -0,0 +1,34 @@
+#include "../../include/minishell.h"
+
+/*
+	Etat neutre de l'entree : aucune source ouverte et aucun crochet
+	readline. C'est le main qui branche readline (init_readline_input),
+	la bibliotheque n'en depend pas.
+*/
+void	reset_input_source(t_input *input)
+{
+	input->source = INPUT_FROM_READLINE;
+	input->is_regular_file = FALSE;
+	input->is_closed = FALSE;
+	input->embedder_pid = ZERO_INIT;
+	input->released_offset = FAIL;
+	input->reader.ring = NULL;
+	input->reader.spill = NULL;
+	input->str = NULL;
+	input->str_pos = ZERO_INIT;
+	input->read_line = NULL;
+	input->on_prompt_sigint = NULL;
+}
+
+/*
+	Shell embarque via libminishell : les lignes arrivent par ms_run_line
+	et se lisent comme une chaine -c, mais sans tail-exec ni exit() dans
+	le processus hote. embedder_pid permet de distinguer l'hote de ses
+	enfants, qui eux doivent toujours sortir.
+*/
+void	init_embedded_input(t_data *data)
+{
+	reset_input_source(&data->input);
+	data->input.source = INPUT_FROM_EMBEDDED;
+	data->input.embedder_pid = getpid();
+}
@@ -0,0 +1,29 @@
+#include "../../include/minishell.h"
+
+/**
+ * @description:
+ * Gestionnaire de signal pour CTRL-C (SIGINT) utilisé dans un contexte général
+ * du programme. Cette fonction définit la réponse du programme à
+ * l'interruption par CTRL-C, typiquement utilisée pour interrompre des
+ * opérations en cours et réinitialiser l'interface utilisateur.
+ */
+void	ctrl_c_handler(int sig)
+{
+	(void)sig;
+	ft_putchar('\n');
+	rl_on_new_line();
+	rl_replace_line("", 0);
+	rl_redisplay();
+	g_globi = 130;
+}
+
+/*
+	Seul le binaire minishell utilise readline : il branche ici la lecture
+	du prompt et le CTRL-C qui redessine la ligne. Le coeur du shell
+	(libminishell.a) n'appelle readline qu'a travers ces crochets.
+*/
+void	init_readline_input(t_data *data)
+{
+	data->input.read_line = readline;
+	data->input.on_prompt_sigint = ctrl_c_handler;
+}
@@ -0,0 +1,96 @@
+#include "../../include/minishell.h"
+
+void	open_script_input(t_data *data, char *path)
+{
+	struct stat	st;
+	int			fd;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		ft_dprintf(STDERR_FILENO, "minishell: %s: %s\n", path, \
+		strerror(errno));
+		exit(EXIT_SCRIPT_NOT_FOUND);
+	}
+	if (ft_reader_init(&data->input.reader, fd) == FT_READER_ERROR)
+	{
+		perror("minishell");
+		exit(1);
+	}
+	data->input.is_regular_file = (fstat(fd, &st) == 0 \
+	&& S_ISREG(st.st_mode));
+	data->input.source = INPUT_FROM_READER;
+}
+
+/*
+	Choisit d'ou viennent les lignes : readline sur un terminal, stdin lu
+	par blocs quand ce n'est pas un terminal, un script lu par blocs avec
+	"minishell FILE", ou la chaine de "minishell -c".
+*/
+void	init_input_source(t_data *data, int ac, char **av)
+{
+	reset_input_source(&data->input);
+	if (ac == 1 && isatty(STDIN_FILENO))
+		return ;
+	if (ac == 1)
+		open_stdin_input(data);
+	else if (is_command_string_mode(ac, av))
+	{
+		data->input.source = INPUT_FROM_STRING;
+		data->input.str = av[2];
+	}
+	else if (ac == 2 && av[1][0] != '-')
+		open_script_input(data, av[1]);
+	else
+		exit_error(ERR_USAGE, data);
+}
+
+char	*read_string_line(t_input *input)
+{
+	char	*start;
+	char	*end;
+
+	start = input->str + input->str_pos;
+	if (!*start)
+		return (NULL);
+	end = strchr(start, '\n');
+	if (!end)
+		end = start + strlen(start);
+	input->str_pos = end - input->str;
+	if (*end == '\n')
+		input->str_pos++;
+	return (strndup(start, end - start));
+}
+
+/*
+	Renvoie la ligne suivante allouee avec malloc (a liberer par
+	l'appelant, comme avec readline), ou NULL en fin d'entree. Le prompt
+	n'est affiche qu'en mode interactif.
+*/
+char	*read_input_line(t_data *data, char *prompt)
+{
+	char	*line;
+	size_t	len;
+
+	if (data->input.source == INPUT_FROM_READLINE)
+		return (data->input.read_line(prompt));
+	if (data->input.source == INPUT_FROM_STRING \
+	|| data->input.source == INPUT_FROM_EMBEDDED)
+		return (read_string_line(&data->input));
+	if (ft_reader_next_line(&data->input.reader, &line, &len) \
+	!= FT_READER_LINE)
+		return (NULL);
+	return (strndup(line, len));
+}
+
+/*
+	Fin de l'entree : en interactif on garde le comportement de CTRL-D,
+	sinon on sort sans rien afficher avec le code de la derniere commande.
+*/
+void	exit_at_end_of_input(t_data *data)
+{
+	if (is_interactive_input(data))
+		exit_all(data);
+	ft_free_all(data);
+	exit_shell_process(data, g_globi);
+}
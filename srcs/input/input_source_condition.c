@@ -0,0 +1,41 @@
+#include "../../include/minishell.h"
+
+bool	is_interactive_input(t_data *data)
+{
+	return (data->input.source == INPUT_FROM_READLINE);
+}
+
+bool	is_command_string_mode(int ac, char **av)
+{
+	return (ac == 3 && !strcmp(av[1], COMMAND_STRING_OPTION));
+}
+
+/*
+	Vrai quand la ligne en cours est la derniere de l'entree : seulement
+	pour une chaine -c ou un script qui est un fichier ordinaire, pour ne
+	jamais bloquer sur un pipe ou un terminal en regardant plus loin.
+*/
+bool	is_input_exhausted(t_data *data)
+{
+	t_reader	*reader;
+
+	if (data->input.source == INPUT_FROM_STRING)
+		return (!data->input.str[data->input.str_pos]);
+	reader = &data->input.reader;
+	if (data->input.source != INPUT_FROM_READER \
+	|| !data->input.is_regular_file || reader->len || reader->spill_len)
+		return (FALSE);
+	if (!reader->is_eof)
+		ft_reader_fill(reader);
+	return (reader->is_eof && !reader->len);
+}
+
+/*
+	Vrai dans le processus qui a appele ms_init, faux dans ses enfants
+	(pipeline, here_doc) : seul l'hote ne doit jamais faire exit().
+*/
+bool	is_embedded_parent(t_data *data)
+{
+	return (data->input.source == INPUT_FROM_EMBEDDED \
+	&& data->input.embedder_pid == getpid());
+}
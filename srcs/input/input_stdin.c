@@ -0,0 +1,78 @@
+#include "../../include/minishell.h"
+
+/*
+	stdin n'est pas un terminal (pipe ou fichier) : pas de readline, pas de
+	prompt ni d'historique, les commandes sont decoupees dans de gros blocs.
+*/
+void	open_stdin_input(t_data *data)
+{
+	struct stat	st;
+
+	if (ft_reader_init(&data->input.reader, STDIN_FILENO) == FT_READER_ERROR)
+	{
+		perror("minishell");
+		exit(1);
+	}
+	data->input.is_regular_file = (fstat(STDIN_FILENO, &st) == 0 \
+	&& S_ISREG(st.st_mode));
+	data->input.source = INPUT_FROM_READER;
+}
+
+/*
+	Quand stdin est un fichier ordinaire, rend aux commandes ce que le
+	lecteur a lu d'avance en reculant l'offset du fd partage : un "cat"
+	lance depuis le script lit la suite du fichier, comme avec bash.
+	Appele juste avant un fork ou le builtin read, pas a chaque ligne ;
+	le tampon est garde pour reclaim_unread_input. Sur un pipe c'est
+	impossible, la suite reste au shell (comme dash).
+*/
+void	release_unread_input(t_data *data)
+{
+	t_reader	*reader;
+	off_t		offset;
+
+	reader = &data->input.reader;
+	if (data->input.source != INPUT_FROM_READER \
+	|| reader->fd != STDIN_FILENO || !data->input.is_regular_file \
+	|| !reader->len || data->input.released_offset != FAIL)
+		return ;
+	offset = lseek(STDIN_FILENO, -(off_t)reader->len, SEEK_CUR);
+	if (offset >= 0)
+		data->input.released_offset = offset;
+}
+
+/*
+	Dans un enfant : le tampon lu d'avance appartient au parent, qui l'a
+	deja rendu ; l'enfant relit depuis l'offset partage et ne doit
+	surtout pas le deplacer en le reprenant.
+*/
+void	drop_unread_input(t_data *data)
+{
+	data->input.released_offset = FAIL;
+	data->input.reader.head = ZERO_INIT;
+	data->input.reader.len = ZERO_INIT;
+	data->input.reader.scanned = ZERO_INIT;
+	data->input.reader.is_eof = FALSE;
+}
+
+/*
+	Apres les enfants : si personne n'a lu stdin, l'offset n'a pas bouge
+	et le tampon est toujours juste, on revient simplement apres lui sans
+	rien relire. Sinon le tampon est perime et la suite est relue depuis
+	l'offset laisse par la commande.
+*/
+void	reclaim_unread_input(t_data *data)
+{
+	t_reader	*reader;
+	off_t		released;
+
+	released = data->input.released_offset;
+	if (released == FAIL)
+		return ;
+	data->input.released_offset = FAIL;
+	reader = &data->input.reader;
+	if (lseek(STDIN_FILENO, 0, SEEK_CUR) == released \
+	&& lseek(STDIN_FILENO, reader->len, SEEK_CUR) >= 0)
+		return ;
+	drop_unread_input(data);
+}
@@ -13,9 +13,9 @@ int	ft_write_fd(char *str, int fd)
 	i = ZERO_INIT;
 	while (str[i])
 		i++;
-	if (write (fd, str, i) == FAIL)
+	if (ft_write(fd, str, i) == FAIL)
 	{
-		ft_printf(ERR_WRIT_NO_SPAC_LEFT_DEVC);
+		ft_dprintf(STDERR_FILENO, ERR_WRIT_NO_SPAC_LEFT_DEVC);
 		g_globi = 1;
 		return (1);
 	}
@@ -63,6 +63,8 @@ void	process_lexer_input(char *str, int *i, int *j, t_quote *state)
 {
 	while (str[*i])
 	{
+		if (skip_paren_expansion(str, i, j, state))
+			continue ;
 		update_quoting_state(str[*i], state);
 		if (!is_white_space(str[*i])
 			&& (!state->doubl_quot_status && !state->singl_quot_status))
@@ -0,0 +1,78 @@
+#include "../../include/minishell.h"
+
+/*
+	Longueur du $((...)) ou du $(...) qui commence en 'str', ou 0.
+	Un $(( sans '))' fermant au bon niveau est une substitution de
+	commande, comme dans bash.
+*/
+size_t	get_paren_expansion_length(const char *str)
+{
+	size_t	len;
+
+	len = get_arith_expansion_length(str);
+	if (len)
+		return (len);
+	return (get_cmd_subst_length(str));
+}
+
+/*
+	Pas d'avance sur un mot : un $((...)) ou $(...) est saute d'un bloc,
+	les quotes de la commande interne ne sont pas celles du mot.
+*/
+int	get_expansion_step(const char *str)
+{
+	size_t	len;
+
+	len = get_paren_expansion_length(str);
+	if (len)
+		return ((int)len);
+	return (1);
+}
+
+/*
+	Pas d'avance hors simples quotes : entre doubles quotes aussi, les
+	quotes d'un $(...) appartiennent a la commande interne.
+*/
+int	get_quoted_expansion_step(const char *str, int is_single_quoted)
+{
+	if (is_single_quoted)
+		return (1);
+	return (get_expansion_step(str));
+}
+
+/*
+	Un $((...)) ou $(...) hors simples quotes forme un seul morceau de
+	mot : ses espaces, operateurs et quotes ne coupent pas la commande et
+	ne changent pas l'etat des quotes du mot.
+*/
+bool	skip_paren_expansion(const char *str, int *i, int *j, t_quote *state)
+{
+	size_t	len;
+
+	if (state->singl_quot_status)
+		return (FALSE);
+	len = get_paren_expansion_length(str + *i);
+	if (!len)
+		return (FALSE);
+	*i += len;
+	*j += len;
+	return (TRUE);
+}
+
+/*
+	Recopie tel quel un $((...)) ou $(...) hors simples quotes, sans ajouter
+	d'espaces autour des '<', '>', '|' et '&' qu'il contient.
+*/
+bool	copy_paren_expansion(const char *command, char *new_command, \
+		size_t *i, size_t *j)
+{
+	size_t	len;
+
+	len = get_paren_expansion_length(command + *i);
+	if (!len)
+		return (FALSE);
+	memcpy(new_command + *j, command + *i, len);
+	*i += len;
+	*j += len;
+	return (TRUE);
+}
@@ -90,15 +90,27 @@ t_data *data, t_lexer *tmp, t_lexer *current, int i)
 }
 
 /*
-	Parcourt et affiche chaque lexer de la liste.
+	Un delimiteur de here_doc contenant des quotes (<<'EOF', <<"EOF",
+	<<E'O'F) rend le corps litteral : on le note sur le lexer et on retire
+	les quotes pour que la comparaison se fasse avec le mot nu.
 */
-void	print_lexer_content1(t_data *data)
+void	mark_quoted_heredoc_delimiters(t_data *data)
 {
 	t_lexer	*current;
+	t_quote	state;
 
 	current = data->lexer_list;
 	while (current != NULL)
 	{
+		if (current->token == DELIMITER \
+		&& (ft_strchr(current->cmd_segment, '\'') \
+		|| ft_strchr(current->cmd_segment, '"')))
+		{
+			current->is_delimiter_quoted = TRUE;
+			reset_quoting_state(&state);
+			current->cmd_segment = create_cleaned_str_excluding_inactive_quots(\
+			current->cmd_segment, &state, data);
+		}
 		current = current->next;
 	}
 }
@@ -120,5 +132,5 @@ void	ft_init_lexer_process(t_data *data)
 	count_words_in_input(data->minishell_input_cmd);
 	i = ZERO_INIT;
 	process_input_string(data, tmp, current, i);
-	print_lexer_content1(data);
+	mark_quoted_heredoc_delimiters(data);
 }
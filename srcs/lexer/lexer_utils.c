@@ -12,6 +12,9 @@ t_lexer	*create_new_lexer(t_data *data, char *str)
 	if (!new)
 		return (NULL);
 	new->cmd_segment = str;
+	new->is_delimiter_quoted = FALSE;
+	new->heredoc_fd = INPUT_FD_NOT_SET;
+	new->builtin_id = tag_builtin_id(str);
 	new->next = NULL;
 	new->prev = NULL;
 	return (new);
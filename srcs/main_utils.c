@@ -48,7 +48,8 @@ size_t	calculate_new_length(const char *command)
 
 /*
 	Effectue la modification de la string, ajoute les espaces avant et apres
-	les operateurs.
+	les operateurs. Un $(...) ou $((...)) hors simples quotes est
+	recopie tel quel.
 */
 void	fill_command_with_spaces(const char *command, char *new_command, \
 		t_quote *state, size_t i)
@@ -59,18 +60,16 @@ void	fill_command_with_spaces(const char *command, char *new_command, \
 	while (command[i])
 	{
 		update_quoting_state(command[i], state);
-		if (is_double_operator(command, i) && (!state->doubl_quot_status && \
-			!state->singl_quot_status))
-		{
-			new_command[j++] = ' ';
-			new_command[j++] = command[i++];
+		if (!state->singl_quot_status \
+		&& copy_paren_expansion(command, new_command, &i, &j))
+			continue ;
+		else if (state->doubl_quot_status || state->singl_quot_status)
 			new_command[j++] = command[i++];
-			new_command[j++] = ' ';
-		}
-		else if (is_operator(command[i]) && (!state->doubl_quot_status && \
-				!state->singl_quot_status))
+		else if (is_operator(command[i]))
 		{
 			new_command[j++] = ' ';
+			if (is_double_operator(command, i))
+				new_command[j++] = command[i++];
 			new_command[j++] = command[i++];
 			new_command[j++] = ' ';
 		}
@@ -0,0 +1,69 @@
+#include "../../include/minishell.h"
+
+/*
+	Prepare le tampon de sortie d'un builtin sur le fd de redirection du
+	noeud, ou sur la sortie standard. Ce qui reste dans le tampon de stdio
+	est vide avant, pour garder l'ordre avec les printf deja faits.
+	Renvoie NULL si la redirection a echoue et que rien ne doit s'afficher.
+*/
+t_outbuf	*start_builtin_output(t_data *data)
+{
+	t_outbuf	*out;
+
+	out = &data->utils->outbuf;
+	out->len = ZERO_INIT;
+	out->has_failed = FALSE;
+	if (data->utils->node->output_fd > 0)
+		out->fd = data->utils->node->output_fd;
+	else if (!data->utils->node->output_redirection_error_id)
+		out->fd = STDOUT_FILENO;
+	else
+		return (NULL);
+	fflush(stdout);
+	return (out);
+}
+
+void	flush_outbuf(t_outbuf *out)
+{
+	if (out->len && !out->has_failed \
+	&& write_all_to_fd(out->fd, out->buffer, out->len) == FAIL)
+		out->has_failed = TRUE;
+	out->len = ZERO_INIT;
+}
+
+/*
+	Copie dans le tampon et ne fait un write que lorsqu'il est plein ;
+	un morceau plus grand que le tampon part directement sur le fd.
+*/
+void	write_outbuf(t_outbuf *out, const char *str, size_t len)
+{
+	if (out->len + len > OUTBUF_SIZE)
+		flush_outbuf(out);
+	if (len > OUTBUF_SIZE)
+	{
+		if (!out->has_failed && write_all_to_fd(out->fd, str, len) == FAIL)
+			out->has_failed = TRUE;
+		return ;
+	}
+	memcpy(out->buffer + out->len, str, len);
+	out->len += len;
+}
+
+void	puts_outbuf(t_outbuf *out, const char *str)
+{
+	write_outbuf(out, str, strlen(str));
+}
+
+/*
+	Vide le tampon en fin de builtin ; une erreur d'ecriture est signalee
+	une seule fois et met le code de retour a 1.
+*/
+void	finish_builtin_output(t_data *data)
+{
+	flush_outbuf(&data->utils->outbuf);
+	if (data->utils->outbuf.has_failed)
+	{
+		ft_dprintf(STDERR_FILENO, ERR_WRIT_NO_SPAC_LEFT_DEVC);
+		g_globi = 1;
+	}
+}
@@ -4,7 +4,8 @@
 	Active ou désactive les indicateurs de guillemets simples ou doubles
 	lorsqu'ils sont rencontrés. Si à la fin, les deux indicateurs sont
 	identiques (soit tous deux activés ou désactivés), il y a une erreur
-	(guillemet non fermé).
+	(guillemet non fermé). Un $(...) hors simples quotes est saute d'un
+	bloc : ses quotes sont celles de la commande interne.
 */
 int	quotes_check(char *str, t_data *data)
 {
@@ -23,7 +24,7 @@ int	quotes_check(char *str, t_data *data)
 			data->is_sing_quot = 1;
 		else if (str[i] == '\'' && data->is_sing_quot && data->is_doub_quot)
 			data->is_sing_quot = 0;
-		i++;
+		i += get_quoted_expansion_step(str + i, data->is_sing_quot);
 	}
 	if (data->is_sing_quot == data->is_doub_quot)
 	{
@@ -124,6 +125,8 @@ int	ft_parser(t_data *data)
 	count = 1;
 	if (!quotes_check(data->minishell_input_cmd, data))
 		count = 0;
+	else if (!cmd_subst_check(data->minishell_input_cmd))
+		count = 0;
 	else if (!cmd_start_check(data->minishell_input_cmd))
 		count = 0;
 	else if (!token_error_check(data))
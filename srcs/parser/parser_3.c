@@ -73,3 +73,37 @@ int	pipe_bracket_check(char *str)
 	}
 	return (1);
 }
+
+/*
+	Un $( sans ')' fermant est une erreur de syntaxe, comme dans bash :
+	la ligne n'est pas executee. Les $( entre simples quotes ne comptent
+	pas, et un $(...) complet est saute d'un bloc avec ses quotes.
+*/
+int	cmd_subst_check(char *str)
+{
+	size_t	i;
+	size_t	len;
+	char	quote;
+
+	i = ZERO_INIT;
+	quote = '\0';
+	while (str[i])
+	{
+		len = 1;
+		if (quote && str[i] == quote)
+			quote = '\0';
+		else if (!quote && (str[i] == '\'' || str[i] == '"'))
+			quote = str[i];
+		else if (quote != '\'' && str[i] == '$' && str[i + 1] == '(')
+		{
+			len = get_paren_expansion_length(str + i);
+			if (!len)
+			{
+				ft_dprintf(STDERR_FILENO, ERR_CMD_SUBST_UNCLOSED);
+				return (0);
+			}
+		}
+		i += len;
+	}
+	return (1);
+}
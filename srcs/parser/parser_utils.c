@@ -51,10 +51,7 @@ int	is_space(char *str, char c)
 	while (str[i])
 	{
 		if (str[i] == c)
-		{
-			ft_printf("found space");
 			return (1);
-		}
 		i++;
 	}
 	return (0);
@@ -0,0 +1,72 @@
+#include "../include/minishell.h"
+
+/*
+	Ajoute les espaces autour des operateurs, construit le lexer et verifie
+	la syntaxe. Renvoie FALSE si la ligne ne doit pas etre executee.
+*/
+bool	parse_command_line(char *tmp, t_data *data)
+{
+	data->minishell_input_cmd = add_spaces_around_operators(data, tmp);
+	mark_trace_phase(data, TRACE_SPACES);
+	ft_init_lexer_process(data);
+	mark_trace_phase(data, TRACE_LEXER);
+	if (!err_code_directory(data) || !ft_parser(data))
+	{
+		mark_trace_phase(data, TRACE_PARSER);
+		return (FALSE);
+	}
+	strip_time_keyword(data);
+	mark_trace_phase(data, TRACE_PARSER);
+	return (TRUE);
+}
+
+/*
+	Fait l'expand puis prepare (here_docs compris) et execute les commandes.
+	Le tail-exec est coupe quand la ligne est tracee, sinon la trace ne
+	serait jamais ecrite.
+*/
+void	execute_command_line(t_data *data)
+{
+	t_lexer	*tmp_lex;
+	char	**new_env;
+	bool	is_expanded;
+
+	tmp_lex = data->lexer_list;
+	new_env = get_new_env(\
+	data, data->utils->linked_list_full_env_var_copy_alpha);
+	mark_trace_phase(data, TRACE_ENV);
+	is_expanded = expand(data->quote, new_env, tmp_lex, data);
+	mark_trace_phase(data, TRACE_EXPAND);
+	if (!is_expanded || !tmp_lex || !tmp_lex->cmd_segment)
+		return ;
+	ft_init_exec(data);
+	mark_trace_phase(data, TRACE_INIT_EXEC);
+	data->is_tail_exec_allowed = is_input_exhausted(data) \
+	&& !is_line_traced(data);
+	manage_execution_resources(data);
+	reclaim_unread_input(data);
+}
+
+/*
+	Traite la ligne de commande saisie par l'utilisateur (tmp), la parse
+	et lui alloue de la memoire.
+	Initialise l'environnement et les variables du lexer.
+	Fait l'expand puis execute les commandes. Avec MINISHELL_TRACE_FD,
+	chaque phase est chronometree et resumee en une ligne JSON.
+	Les compteurs d'appels systeme de la ligne sont lus par shellstat.
+*/
+void	prompt_loop(char *tmp, t_data *data, char **env)
+{
+	(void)env;
+	if (!tmp)
+		exit_at_end_of_input(data);
+	if (!tmp[0])
+		return ;
+	data->line_mark = data->trash_memory;
+	start_line_trace(data);
+	begin_line_stats();
+	if (parse_command_line(tmp, data))
+		execute_command_line(data);
+	end_line_stats();
+	emit_line_trace(data);
+}
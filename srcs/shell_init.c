@@ -0,0 +1,96 @@
+#include "../include/minishell.h"
+
+/*
+	La variable globale "globi" a comme role de renvoyer les codes de retours
+	des commandes. Ces codes de retour indiquent si une commande a été exécutée
+	avec succès ou s'il y a eu une erreur et, dans ce dernier cas, quelle était
+	la nature de l'erreur.
+*/
+unsigned int	g_globi = ZERO_INIT;
+
+/*
+	Responsable de l'initialisation de la structure 't_data', qui contient
+	toutes les données principales utilisées par le programme.
+*/
+void	init_data(t_data *data, int ac, char **av, char **env)
+{
+	data->command_line_arg_count = ac;
+	data->command_line_args = av;
+	data->full_env_var_copy_alpha = env;
+	data->trash_memory = NULL;
+	data->env_memory = NULL;
+	data->line_mark = NULL;
+	data->utils = NULL;
+	data->minishell_input_cmd = NULL;
+	data->lexer_list = NULL;
+	data->is_tail_exec_allowed = FALSE;
+	data->history.last_line = NULL;
+}
+
+/*
+	Utilisée pour renvoyer un message d'erreur sur la sortie d'erreur dans le
+	cas ou l'utilisateur lancerait le programme avec d'autres arguments que
+	"./minishell", "./minishell FILE" ou "./minishell -c STRING".
+	Dans le processus hote de libminishell, rend FAIL au lieu de sortir.
+*/
+int	exit_error(char *str, t_data *data)
+{
+	ft_write_fd(str, STDERR_FILENO);
+	if (is_embedded_parent(data))
+	{
+		g_globi = 1;
+		return (FAIL);
+	}
+	exit(1);
+}
+
+/*
+	Sortie d'un processus du shell. Un enfant d'un shell embarque sort
+	avec _exit : exit() lancerait les atexit de l'hote et viderait ses
+	FILE une seconde fois. Seul stdout, vide avant chaque fork et donc
+	rempli par l'enfant lui-meme, est ecrit avant.
+*/
+void	exit_shell_process(t_data *data, int exit_code)
+{
+	if (data->input.source == INPUT_FROM_EMBEDDED)
+	{
+		fflush(stdout);
+		_exit(exit_code);
+	}
+	exit(exit_code);
+}
+
+/*
+	Parcourt la liste chaînée 'env_lst' contenant les variables
+	d'environnement et en construit un tableau de chaînes de caractères.
+	Ce tableau est utilisé pour passer l'environnement
+	aux processus enfants créés par le shell.
+*/
+char	**get_new_env(t_data *data, t_env *env_lst)
+{
+	char	**new_env;
+	int		i;
+	t_env	*head;
+
+	head = env_lst;
+	i = ZERO_INIT;
+	while (env_lst)
+	{
+		i++;
+		env_lst = env_lst->next_var_env_name_and_value;
+	}
+	new_env = malloc_track(data, sizeof(char *) * \
+				(i + 1));
+	if (!new_env)
+		return (NULL);
+	new_env[i] = NULL;
+	env_lst = head;
+	i = 0;
+	while (env_lst)
+	{
+		new_env[i++] = env_lst->var_env_name_and_value;
+		env_lst = env_lst->next_var_env_name_and_value;
+	}
+	env_lst = head;
+	return (new_env);
+}
@@ -1,22 +1,5 @@
 #include "../../include/minishell.h"
 
-/**
- * @description:
- * Gestionnaire de signal pour CTRL-C (SIGINT) utilisé dans un contexte général
- * du programme. Cette fonction définit la réponse du programme à
- * l'interruption par CTRL-C, typiquement utilisée pour interrompre des
- * opérations en cours et réinitialiser l'interface utilisateur.
- */
-void	ctrl_c_handler(int sig)
-{
-	(void)sig;
-	ft_putchar('\n');
-	rl_on_new_line();
-	rl_replace_line("", 0);
-	rl_redisplay();
-	g_globi = 130;
-}
-
 /**
  * @description:
  * Gestionnaire de signal pour le signal CTRL-C (SIGINT) spécifique au contexte
@@ -42,17 +25,10 @@ void	ctrl_c_handler_here_doc(int sig)
 void	handle_sig(t_data *data)
 {
 	if (data->utils->is_this_an_exec_in_heredoc)
-	{
 		signal(SIGINT, &ctrl_c_handler_here_doc);
-		if (g_globi == 130)
-		{
-			data->utils->is_this_an_exec_in_heredoc = 0;
-			data->utils->heredoc_ctrl_c_uninterrupted = 0;
-		}
-	}
-	else
+	else if (data->input.on_prompt_sigint)
 	{
-		signal(CTRL_C_SIGINT, &ctrl_c_handler);
+		signal(CTRL_C_SIGINT, data->input.on_prompt_sigint);
 		signal(CTRL_BACKSLSH, IGNORE_SIG_ACTION);
 	}
 }
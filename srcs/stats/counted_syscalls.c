@@ -0,0 +1,37 @@
+#define _GNU_SOURCE
+#include "../../include/minishell.h"
+
+/*
+	stdout est vide avant le fork : l'enfant n'herite pas d'un tampon
+	deja rempli, qu'il ecrirait une seconde fois en sortant.
+*/
+pid_t	ft_fork(void)
+{
+	count_shell_stat(STAT_FORK);
+	fflush(stdout);
+	return (fork());
+}
+
+int	ft_pipe(int *fd, int flags)
+{
+	count_shell_stat(STAT_PIPE);
+	return (pipe2(fd, flags));
+}
+
+int	ft_dup2(int old_fd, int new_fd)
+{
+	count_shell_stat(STAT_DUP2);
+	return (dup2(old_fd, new_fd));
+}
+
+int	ft_open(const char *path, int flags, mode_t mode)
+{
+	count_shell_stat(STAT_OPEN);
+	return (open(path, flags, mode));
+}
+
+int	ft_access(const char *path, int mode)
+{
+	count_shell_stat(STAT_ACCESS);
+	return (access(path, mode));
+}
@@ -0,0 +1,7 @@
+#include "../../include/minishell.h"
+
+ssize_t	ft_write(int fd, const void *buf, size_t len)
+{
+	count_shell_stat(STAT_WRITE);
+	return (write(fd, buf, len));
+}
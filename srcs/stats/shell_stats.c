@@ -0,0 +1,73 @@
+#include <sys/mman.h>
+#include "../../include/minishell.h"
+
+/*
+	Les wrappers de appels systeme sont appeles de partout, souvent sans
+	t_data sous la main : on garde ici l'adresse des compteurs du shell.
+*/
+t_shellstat	*get_shell_stats(t_shellstat *stats)
+{
+	static t_shellstat	*current;
+
+	if (stats)
+		current = stats;
+	return (current);
+}
+
+/*
+	Les compteurs sont dans une page partagee (MAP_SHARED) pour que les
+	appels faits par les enfants d'un pipeline soient comptes eux aussi.
+	Si mmap echoue, le shell tourne simplement sans compteurs. Un second
+	shell embarque (ms_init apres ms_free) reprend la meme page.
+*/
+void	init_shell_stats(void)
+{
+	t_shellstat	*stats;
+
+	if (get_shell_stats(NULL))
+		return ;
+	stats = mmap(NULL, sizeof(t_shellstat), PROT_READ | PROT_WRITE, \
+	MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (stats == MAP_FAILED)
+		return ;
+	memset(stats, 0, sizeof(t_shellstat));
+	get_shell_stats(stats);
+}
+
+void	count_shell_stat(int id)
+{
+	t_shellstat	*stats;
+
+	stats = get_shell_stats(NULL);
+	if (stats)
+		__sync_fetch_and_add(&stats->total[id], 1);
+}
+
+void	begin_line_stats(void)
+{
+	t_shellstat	*stats;
+
+	stats = get_shell_stats(NULL);
+	if (stats)
+		memcpy(stats->line_start, stats->total, sizeof(stats->total));
+}
+
+/*
+	Les enfants ont tous ete attendus a ce stade : la difference avec le
+	debut de ligne est le cout complet de la ligne.
+*/
+void	end_line_stats(void)
+{
+	t_shellstat	*stats;
+	int			id;
+
+	stats = get_shell_stats(NULL);
+	if (!stats)
+		return ;
+	id = ZERO_INIT;
+	while (id < STAT_NB)
+	{
+		stats->last_line[id] = stats->total[id] - stats->line_start[id];
+		id++;
+	}
+}
@@ -0,0 +1,38 @@
+#include "../../include/minishell.h"
+
+/*
+	Renvoie le fd sur lequel ecrire la trace, donne par la variable
+	MINISHELL_TRACE_FD, ou FAIL si elle est absente ou invalide.
+*/
+int	get_trace_fd(t_data *data)
+{
+	char	*value;
+	int		i;
+
+	value = get_env_var_value(data, ENV_TRACE_FD);
+	if (!value || !value[0])
+		return (FAIL);
+	i = ZERO_INIT;
+	while (value[i])
+	{
+		if (!is_decimal_digit(value[i]) || i > 9)
+			return (FAIL);
+		i++;
+	}
+	return ((int)ft_atoll(value));
+}
+
+/*
+	Ajoute la taille d'un here_doc collecte a la trace de la ligne en cours.
+*/
+void	trace_heredoc_stats(t_data *data, t_heredoc_sink *sink)
+{
+	t_trace	*trace;
+
+	trace = &data->utils->trace;
+	if (trace->fd < 0)
+		return ;
+	trace->nb_heredoc++;
+	trace->heredoc_bytes += sink->total_bytes;
+	trace->heredoc_lines += sink->total_lines;
+}
@@ -0,0 +1,72 @@
+#include "../../include/minishell.h"
+
+long	elapsed_trace_ns(struct timespec *from, struct timespec *to)
+{
+	return ((to->tv_sec - from->tv_sec) * NSEC_PER_SEC \
+	+ (to->tv_nsec - from->tv_nsec));
+}
+
+/*
+	Active la trace de la ligne si MINISHELL_TRACE_FD est defini et remet
+	les compteurs a zero ; sans la variable, rien n'est mesure.
+*/
+void	start_line_trace(t_data *data)
+{
+	t_trace	*trace;
+	int		phase;
+
+	trace = &data->utils->trace;
+	trace->fd = get_trace_fd(data);
+	if (trace->fd < 0)
+		return ;
+	phase = -1;
+	while (++phase < TRACE_NB_PHASE)
+		trace->phase_ns[phase] = ZERO_INIT;
+	trace->nb_heredoc = ZERO_INIT;
+	trace->heredoc_bytes = ZERO_INIT;
+	trace->heredoc_lines = ZERO_INIT;
+	clock_gettime(CLOCK_MONOTONIC, &trace->start);
+	trace->mark = trace->start;
+}
+
+/*
+	Attribue a la phase le temps ecoule depuis la marque precedente.
+*/
+void	mark_trace_phase(t_data *data, int phase)
+{
+	t_trace			*trace;
+	struct timespec	now;
+
+	trace = &data->utils->trace;
+	if (trace->fd < 0)
+		return ;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	trace->phase_ns[phase] += elapsed_trace_ns(&trace->mark, &now);
+	trace->mark = now;
+}
+
+/*
+	Une ligne JSON par ligne de commande, ecrite en un seul write.
+*/
+void	emit_line_trace(t_data *data)
+{
+	t_trace	*t;
+	long	*ns;
+
+	t = &data->utils->trace;
+	if (t->fd < 0)
+		return ;
+	ns = t->phase_ns;
+	ft_dprintf(t->fd, "{\"phases_ns\":{\"spaces\":%ld,\"lexer\":%ld,\
+\"parser\":%ld,\"env\":%ld,\"expand\":%ld,\"init_exec\":%ld,\"launch\":%ld,\
+\"wait\":%ld},\"total_ns\":%ld,\"heredoc\":{\"count\":%zu,\"bytes\":%zu,\
+\"lines\":%zu},\"status\":%u}\n", ns[TRACE_SPACES], ns[TRACE_LEXER], \
+	ns[TRACE_PARSER], ns[TRACE_ENV], ns[TRACE_EXPAND], ns[TRACE_INIT_EXEC], \
+	ns[TRACE_LAUNCH], ns[TRACE_WAIT], elapsed_trace_ns(&t->start, &t->mark), \
+	t->nb_heredoc, t->heredoc_bytes, t->heredoc_lines, g_globi);
+}
+
+bool	is_line_traced(t_data *data)
+{
+	return (data->utils->trace.fd >= 0);
+}